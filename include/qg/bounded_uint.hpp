@@ -0,0 +1,195 @@
+#pragma once
+
+#include <qg/static_uint.hpp>
+
+#include <array>
+#include <climits>
+#include <cstdint>
+
+/**
+ * bounded_uint: an unsigned integer of at most max_bits bits, which
+ * keeps track of how many of its limbs are in use
+ * The limbs are those of a static_uint<max_bits>, with every limb
+ * past the used ones kept at zero, so converting from and to it is a
+ * copy plus (from) a scan for the top nonzero limb
+ * Arithmetic, comparisons and shifts only go through the used limbs,
+ * which makes small values cheap in a large type; like static_uint,
+ * everything wraps around at max_bits bits
+ */
+template <std::size_t max_bits, typename limb = std::uint64_t>
+struct bounded_uint {
+    using value_type = static_uint<max_bits, limb>;
+
+  private:
+    static constexpr auto N =
+        detail::required_array_size(max_bits, sizeof(limb));
+    static constexpr auto limb_bits = sizeof(limb) * CHAR_BIT;
+
+    std::array<limb, N> data{};
+    std::size_t used = 0;
+
+    // drops the zero limbs from the top of the used ones
+    constexpr void trim() noexcept {
+        while (used != 0 && data[used - 1] == 0) {
+            --used;
+        }
+    }
+    // after an operation that may have reached the top limb
+    constexpr void wrap() noexcept {
+        detail::mask_top_limb<max_bits>(data);
+        trim();
+    }
+
+  public:
+    /**
+     * Constructors for default/value initialisation, initialisation
+     * from platform-sized integers and from the static_uint of the
+     * same size
+     */
+    constexpr bounded_uint() noexcept = default;
+    constexpr bounded_uint(std::size_t in) noexcept
+        : bounded_uint{value_type{in}} {}
+    constexpr bounded_uint(value_type const& in) noexcept
+        : data{detail::limb_access::get(in)}, used{N} {
+        trim();
+    }
+
+    constexpr value_type to_static_uint() const noexcept {
+        auto result = value_type{};
+        detail::limb_access::get(result) = data;
+        return result;
+    }
+    constexpr explicit operator value_type() const noexcept {
+        return to_static_uint();
+    }
+
+    /**
+     * Number of limbs up to the most significant nonzero one, 0 for
+     * the value 0
+     */
+    constexpr std::size_t used_limbs() const noexcept { return used; }
+
+    // comparisons
+    friend constexpr int compare(bounded_uint const& lhs,
+                                 bounded_uint const& rhs) noexcept {
+        if (lhs.used != rhs.used) {
+            return lhs.used < rhs.used ? -1 : 1;
+        }
+        return detail::compare_limbs(lhs.data.data(), lhs.used,
+                                     rhs.data.data(), rhs.used);
+    }
+    friend constexpr bool operator==(
+        bounded_uint const& lhs, bounded_uint const& rhs) noexcept {
+        return compare(lhs, rhs) == 0;
+    }
+    friend constexpr bool operator!=(
+        bounded_uint const& lhs, bounded_uint const& rhs) noexcept {
+        return compare(lhs, rhs) != 0;
+    }
+    friend constexpr bool operator<(
+        bounded_uint const& lhs, bounded_uint const& rhs) noexcept {
+        return compare(lhs, rhs) < 0;
+    }
+    friend constexpr bool operator>(
+        bounded_uint const& lhs, bounded_uint const& rhs) noexcept {
+        return compare(lhs, rhs) > 0;
+    }
+    friend constexpr bool operator<=(
+        bounded_uint const& lhs, bounded_uint const& rhs) noexcept {
+        return compare(lhs, rhs) <= 0;
+    }
+    friend constexpr bool operator>=(
+        bounded_uint const& lhs, bounded_uint const& rhs) noexcept {
+        return compare(lhs, rhs) >= 0;
+    }
+
+    // arithmetic
+    constexpr bounded_uint& operator+=(
+        bounded_uint const& other) noexcept {
+        auto const n = used > other.used ? used : other.used;
+        auto const carry = detail::add_limbs(
+            data.data(), n, other.data.data(), other.used);
+        used = n;
+        if (carry && n < N) {
+            data[used++] = 1;
+        }
+        wrap();
+        return *this;
+    }
+    friend constexpr bounded_uint operator+(
+        bounded_uint const& lhs, bounded_uint const& rhs) noexcept {
+        auto result = lhs;
+        return result += rhs;
+    }
+
+    // a negative difference wraps around, and uses every limb
+    constexpr bounded_uint& operator-=(
+        bounded_uint const& other) noexcept {
+        if (*this < other) {
+            used = N;
+        }
+        detail::sub_limbs(data.data(), used, other.data.data(),
+                          other.used);
+        wrap();
+        return *this;
+    }
+    friend constexpr bounded_uint operator-(
+        bounded_uint const& lhs, bounded_uint const& rhs) noexcept {
+        auto result = lhs;
+        return result -= rhs;
+    }
+
+    constexpr bounded_uint& operator*=(
+        bounded_uint const& other) noexcept {
+        return *this = *this * other;
+    }
+    friend constexpr bounded_uint operator*(
+        bounded_uint const& lhs, bounded_uint const& rhs) noexcept {
+        auto result = bounded_uint{};
+        if (lhs.used == 0 || rhs.used == 0) {
+            return result;
+        }
+        auto const n = lhs.used + rhs.used;
+        result.used = n < N ? n : N;
+        detail::mul_limbs(result.data.data(), result.used,
+                          lhs.data.data(), lhs.used, rhs.data.data(),
+                          rhs.used);
+        result.wrap();
+        return result;
+    }
+
+    // shifts, by max_bits or more give 0
+    constexpr bounded_uint& operator<<=(unsigned int shift) noexcept {
+        if (shift >= max_bits) {
+            return *this = bounded_uint{};
+        }
+        if (used == 0) {
+            return *this;
+        }
+        // one more limb than the shift moves by, for the carried bits
+        auto const n = used + shift / limb_bits + 1;
+        used = n < N ? n : N;
+        detail::shl_limbs(data.data(), used, shift);
+        wrap();
+        return *this;
+    }
+    friend constexpr bounded_uint operator<<(
+        bounded_uint const& lhs, unsigned int shift) noexcept {
+        auto result = lhs;
+        return result <<= shift;
+    }
+
+    constexpr bounded_uint& operator>>=(unsigned int shift) noexcept {
+        if (shift >= used * limb_bits) {
+            return *this = bounded_uint{};
+        }
+        detail::shr_limbs(data.data(), data.data(), used, shift);
+        trim();
+        return *this;
+    }
+    friend constexpr bounded_uint operator>>(
+        bounded_uint const& lhs, unsigned int shift) noexcept {
+        auto result = lhs;
+        return result >>= shift;
+    }
+};
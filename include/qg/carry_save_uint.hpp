@@ -0,0 +1,67 @@
+#pragma once
+
+#include <qg/static_uint.hpp>
+
+#include <climits>
+#include <cstdint>
+
+/**
+ * carry_save_uint: an accumulator keeping its value as the sum of two
+ * static_uints, a partial sum and the carries that haven't been
+ * propagated yet
+ * Adding to it is a 3:2 compression (a full adder on every bit), so
+ * no carry travels more than one bit and every limb is computed
+ * independently of the others
+ * normalize performs the single carry-propagating addition, and like
+ * static_uint everything wraps around at 'size' bits
+ */
+template <std::size_t size, typename limb = std::uint64_t>
+struct carry_save_uint {
+    using value_type = static_uint<size, limb>;
+
+  private:
+    value_type sum{};
+    value_type carries{};
+
+    // sum + carries + value, compressed back into sum and carries
+    constexpr void compress(value_type const& value) noexcept {
+        constexpr auto limb_bits = sizeof(limb) * CHAR_BIT;
+        auto& s = detail::limb_access::get(sum);
+        auto& c = detail::limb_access::get(carries);
+        auto const& v = detail::limb_access::get(value);
+        limb carry_in = 0;
+        for (std::size_t i = 0; i < s.size(); ++i) {
+            auto const majority =
+                (s[i] & c[i]) | (s[i] & v[i]) | (c[i] & v[i]);
+            s[i] = s[i] ^ c[i] ^ v[i];
+            // carries are worth twice their position
+            c[i] = static_cast<limb>(majority << 1) | carry_in;
+            carry_in = majority >> (limb_bits - 1);
+        }
+        detail::mask_top_limb<size>(c);
+    }
+
+  public:
+    constexpr carry_save_uint() noexcept = default;
+    constexpr carry_save_uint(value_type const& value) noexcept
+        : sum{value}, carries{} {}
+
+    constexpr carry_save_uint& operator+=(
+        value_type const& value) noexcept {
+        compress(value);
+        return *this;
+    }
+    constexpr carry_save_uint& operator+=(
+        carry_save_uint const& other) noexcept {
+        compress(other.sum);
+        compress(other.carries);
+        return *this;
+    }
+
+    /**
+     * The value as a static_uint, with one full addition
+     */
+    constexpr value_type normalize() const noexcept {
+        return sum + carries;
+    }
+};
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <qg/static_uint.hpp>
+
+#include <climits>
+#include <cstdint>
+
+/**
+ * Rounding policies for fixed, applied whenever a result has more
+ * fractional bits than the type can keep
+ * 'shift' drops the lowest 'bits' bits of a value, 'divide' rounds a
+ * quotient
+ */
+struct round_toward_zero {
+    template <typename uint>
+    static constexpr uint shift(uint const& value,
+                                unsigned int bits) noexcept {
+        return value >> bits;
+    }
+    template <typename uint>
+    static constexpr uint divide(uint const& lhs,
+                                 uint const& rhs) noexcept {
+        return lhs / rhs;
+    }
+};
+
+// halfway cases are rounded up
+struct round_to_nearest {
+    template <typename uint>
+    static constexpr uint shift(uint const& value,
+                                unsigned int bits) noexcept {
+        auto result = value >> bits;
+        if (bits != 0 && ((value >> (bits - 1)) & 1u) != 0) {
+            ++result;
+        }
+        return result;
+    }
+    template <typename uint>
+    static constexpr uint divide(uint const& lhs,
+                                 uint const& rhs) noexcept {
+        auto [quotient, remainder] = divmod(lhs, rhs);
+        // remainder >= rhs / 2, without overflowing
+        if (remainder >= rhs - remainder) {
+            ++quotient;
+        }
+        return quotient;
+    }
+};
+
+// halfway cases are rounded to the even neighbour
+struct round_to_nearest_even {
+    template <typename uint>
+    static constexpr uint shift(uint const& value,
+                                unsigned int bits) noexcept {
+        auto result = value >> bits;
+        if (bits == 0 || ((value >> (bits - 1)) & 1u) == 0) {
+            return result;
+        }
+        auto const below_half = value & ((uint{1} << (bits - 1)) - 1);
+        if (below_half != 0 || (result & 1u) != 0) {
+            ++result;
+        }
+        return result;
+    }
+    template <typename uint>
+    static constexpr uint divide(uint const& lhs,
+                                 uint const& rhs) noexcept {
+        auto [quotient, remainder] = divmod(lhs, rhs);
+        auto const other = rhs - remainder;
+        if (remainder > other ||
+            (remainder == other && (quotient & 1u) != 0)) {
+            ++quotient;
+        }
+        return quotient;
+    }
+};
+
+/**
+ * fixed: an unsigned fixed-point number with int_bits integral bits
+ * and frac_bits fractional bits, stored as a static_uint of their sum
+ * Products are computed at double width and divisions pre-shift the
+ * dividend, so no precision is lost before the single rounding step,
+ * which the rounding policy decides
+ * Every rescaling shift is by the compile-time constant frac_bits
+ */
+template <std::size_t int_bits, std::size_t frac_bits,
+          typename rounding = round_toward_zero,
+          typename limb = std::uint64_t>
+struct fixed {
+    static constexpr auto size = int_bits + frac_bits;
+    using storage_type = static_uint<size, limb>;
+
+  private:
+    storage_type raw;
+
+    using dividend_type = static_uint<size + frac_bits, limb>;
+
+  public:
+    /**
+     * Constructors for default/value initialisation and
+     * initialisation from integers
+     */
+    constexpr fixed() noexcept = default;
+    constexpr fixed(std::size_t in) noexcept
+        : raw{storage_type{in} << frac_bits} {}
+
+    /**
+     * Access to the underlying representation, value * 2^frac_bits
+     */
+    static constexpr fixed from_raw(storage_type const& in) noexcept {
+        auto result = fixed{};
+        result.raw = in;
+        return result;
+    }
+    constexpr storage_type const& to_raw() const noexcept {
+        return raw;
+    }
+
+    // both returned as integers, the fractional part in units of
+    // 2^-frac_bits
+    constexpr storage_type integral_part() const noexcept {
+        return raw >> frac_bits;
+    }
+    constexpr storage_type fractional_part() const noexcept {
+        return raw & ((storage_type{1} << frac_bits) - 1);
+    }
+
+    // comparisons
+    friend constexpr bool operator==(fixed const& lhs,
+                                     fixed const& rhs) noexcept {
+        return lhs.raw == rhs.raw;
+    }
+    friend constexpr bool operator!=(fixed const& lhs,
+                                     fixed const& rhs) noexcept {
+        return lhs.raw != rhs.raw;
+    }
+    friend constexpr bool operator<(fixed const& lhs,
+                                    fixed const& rhs) noexcept {
+        return lhs.raw < rhs.raw;
+    }
+    friend constexpr bool operator>(fixed const& lhs,
+                                    fixed const& rhs) noexcept {
+        return lhs.raw > rhs.raw;
+    }
+    friend constexpr bool operator<=(fixed const& lhs,
+                                     fixed const& rhs) noexcept {
+        return lhs.raw <= rhs.raw;
+    }
+    friend constexpr bool operator>=(fixed const& lhs,
+                                     fixed const& rhs) noexcept {
+        return lhs.raw >= rhs.raw;
+    }
+
+    // arithmetic, wrapping around at 2^int_bits
+    constexpr fixed& operator+=(fixed const& other) noexcept {
+        raw += other.raw;
+        return *this;
+    }
+    friend constexpr fixed operator+(fixed const& lhs,
+                                     fixed const& rhs) noexcept {
+        auto result = lhs;
+        return result += rhs;
+    }
+    constexpr fixed& operator-=(fixed const& other) noexcept {
+        raw -= other.raw;
+        return *this;
+    }
+    friend constexpr fixed operator-(fixed const& lhs,
+                                     fixed const& rhs) noexcept {
+        auto result = lhs;
+        return result -= rhs;
+    }
+
+    constexpr fixed& operator*=(fixed const& other) noexcept {
+        return *this = *this * other;
+    }
+    friend constexpr fixed operator*(fixed const& lhs,
+                                     fixed const& rhs) noexcept {
+        auto const product = mul_wide(lhs.raw, rhs.raw);
+        return from_raw(truncate<size>(
+            rounding::shift(product, frac_bits)));
+    }
+
+    // dividing by zero is undefined
+    constexpr fixed& operator/=(fixed const& other) noexcept {
+        return *this = *this / other;
+    }
+    friend constexpr fixed operator/(fixed const& lhs,
+                                     fixed const& rhs) noexcept {
+        auto const dividend = dividend_type{lhs.raw} << frac_bits;
+        return from_raw(truncate<size>(
+            rounding::divide(dividend, dividend_type{rhs.raw})));
+    }
+};
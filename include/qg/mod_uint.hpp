@@ -0,0 +1,703 @@
+#pragma once
+
+#include <qg/static_uint.hpp>
+
+#include <array>
+#include <climits>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace detail {
+/*
+ * a * b * R^-1 mod m, with R = 2^(n * limb bits), a, b < m and m odd
+ * (Montgomery multiplication, coarsely integrated operand scanning)
+ * m_inv is -m^-1 mod 2^(limb bits)
+ */
+template <typename limb, std::size_t n>
+constexpr std::array<limb, n> montgomery_mul(
+    std::array<limb, n> const& a, std::array<limb, n> const& b,
+    std::array<limb, n> const& m, limb m_inv) noexcept {
+    // stays below 2m, plus room for the carries of each row
+    auto t = std::array<limb, n + 2>{};
+    for (std::size_t i = 0; i < n; ++i) {
+        auto carry = addmul_limb(t.data(), a.data(), n, b[i]);
+        add_limbs(t.data() + n, 2, &carry, 1);
+        // adding q * m clears the lowest limb...
+        auto const q = static_cast<limb>(t[0] * m_inv);
+        carry = addmul_limb(t.data(), m.data(), n, q);
+        add_limbs(t.data() + n, 2, &carry, 1);
+        // ...which the division by the limb base drops
+        for (std::size_t j = 0; j < n + 1; ++j) {
+            t[j] = t[j + 1];
+        }
+        t[n + 1] = 0;
+    }
+    if (t[n] != 0 || compare_limbs(t.data(), n, m.data(), n) >= 0) {
+        sub_limbs(t.data(), n + 1, m.data(), n);
+    }
+    auto result = std::array<limb, n>{};
+    for (std::size_t i = 0; i < n; ++i) {
+        result[i] = t[i];
+    }
+    return result;
+}
+
+/*
+ * 2^bits mod m, by repeated doubling
+ * Only used to compute constants at compile time
+ */
+template <std::size_t size, typename limb>
+constexpr static_uint<size, limb> pow2_mod(
+    std::size_t bits, static_uint<size, limb> const& m) noexcept {
+    using wide = static_uint<size + 1, limb>;
+    auto result = wide{1} % wide{m};
+    for (std::size_t i = 0; i < bits; ++i) {
+        result <<= 1;
+        if (result >= wide{m}) {
+            result -= wide{m};
+        }
+    }
+    return truncate<size>(result);
+}
+
+/*
+ * Reduction engines for mod_uint
+ * Each one picks the representation values are kept in (always below
+ * the modulus), and how products of those are reduced
+ * from_product turns a reduced product of two representations back
+ * into the representation of the product
+ * All of their constants are computed at compile time from the
+ * modulus
+ */
+
+/*
+ * Montgomery form, for odd moduli: x is kept as x * R mod m, and
+ * products are reduced with multiplications by constants and shifts
+ * by whole limbs instead of a division
+ */
+template <std::size_t size, typename limb, typename modulus>
+struct montgomery_reduction {
+    using uint = static_uint<size, limb>;
+
+    static constexpr uint m = modulus::value;
+    static constexpr std::size_t n =
+        required_array_size(size, sizeof(limb));
+    static constexpr auto limb_bits = sizeof(limb) * CHAR_BIT;
+
+    static constexpr limb compute_m_inv() noexcept {
+        auto const m0 = limb_access::get(m)[0];
+        // Newton's iteration doubles the number of correct low bits,
+        // starting from 3 (m0 * m0 == 1 mod 8 for odd m0)
+        auto inv = m0;
+        for (std::size_t bits = 3; bits < limb_bits; bits *= 2) {
+            inv *= static_cast<limb>(2 - m0 * inv);
+        }
+        return static_cast<limb>(0 - inv);
+    }
+    static constexpr limb m_inv = compute_m_inv();
+    // R^2 mod m, which takes a value into Montgomery form
+    static constexpr uint r2 = pow2_mod(2 * n * limb_bits, m);
+
+    static constexpr uint mul(uint const& lhs,
+                              uint const& rhs) noexcept {
+        auto result = uint{};
+        limb_access::get(result) = montgomery_mul(
+            limb_access::get(lhs), limb_access::get(rhs),
+            limb_access::get(m), m_inv);
+        return result;
+    }
+    static constexpr uint to_rep(uint const& value) noexcept {
+        return mul(value, r2);
+    }
+    static constexpr uint from_rep(uint const& rep) noexcept {
+        return mul(rep, uint{1});
+    }
+    // (a * R) * (b * R) carries an extra factor of R
+    static constexpr uint from_product(uint const& product) noexcept {
+        return mul(product, uint{1});
+    }
+};
+
+/*
+ * Barrett reduction, for even moduli: values are kept as they are,
+ * and products are reduced with a precomputed approximation of 1 / m
+ * mu = floor(4^k / m), with k the bit width of m
+ */
+template <std::size_t size, typename limb, typename modulus>
+struct barrett_reduction {
+    using uint = static_uint<size, limb>;
+    // fits m^2, and the intermediate product of the quotient estimate
+    using wide = static_uint<2 * size + 2, limb>;
+
+    static constexpr uint m = modulus::value;
+    static constexpr unsigned int k = bit_width(m);
+    static constexpr wide mu = (wide{1} << (2 * k)) / wide{m};
+
+    static constexpr uint reduce(wide const& value) noexcept {
+        // the estimate is at most 2 below the real quotient
+        auto const q = ((value >> (k - 1)) * mu) >> (k + 1);
+        auto r = value - q * wide{m};
+        while (r >= wide{m}) {
+            r -= wide{m};
+        }
+        return truncate<size>(r);
+    }
+    static constexpr uint mul(uint const& lhs,
+                              uint const& rhs) noexcept {
+        return reduce(wide{mul_wide(lhs, rhs)});
+    }
+    static constexpr uint to_rep(uint const& value) noexcept {
+        return value;
+    }
+    static constexpr uint from_rep(uint const& rep) noexcept {
+        return rep;
+    }
+    static constexpr uint from_product(uint const& product) noexcept {
+        return product;
+    }
+};
+
+/*
+ * Folding a value by 2^k - c replaces its bits above 2^k, high, with
+ * high * c, which is the same mod 2^k - c
+ * plan_folds follows an upper bound of a product of two values below
+ * m through the folds, to find how many take it below 2m, and how
+ * wide it is after the first one: folds is 0 if the bound stops
+ * shrinking first
+ */
+struct fold_plan {
+    unsigned int folds;
+    std::size_t bits;
+};
+
+template <std::size_t size, typename limb>
+constexpr fold_plan plan_folds(
+    static_uint<size, limb> const& m) noexcept {
+    using wide = static_uint<2 * size + 2, limb>;
+    auto const k = bit_width(m);
+    auto const c = (wide{1} << k) - wide{m};
+    auto const low_max = (wide{1} << k) - 1u;
+    auto bound = (wide{m} - 1u) * (wide{m} - 1u);
+    auto plan = fold_plan{0, 0};
+    while (bound >= wide{m} + wide{m}) {
+        auto const high = bound >> k;
+        auto const next = high * c + low_max;
+        if (next >= bound) {
+            return fold_plan{0, 0};
+        }
+        if (plan.folds == 0) {
+            plan.bits = bit_width(next);
+        }
+        ++plan.folds;
+        bound = next;
+    }
+    return plan;
+}
+
+/*
+ * Pseudo-Mersenne moduli 2^k - c, with c at most half as wide as the
+ * modulus, like 2^255 - 19, 2^127 - 1 or 2^256 - 2^32 - 977
+ */
+template <std::size_t size, typename limb>
+constexpr bool is_special_form(
+    static_uint<size, limb> const& m) noexcept {
+    using wide = static_uint<size + 1, limb>;
+    auto const k = bit_width(m);
+    auto const c = (wide{1} << k) - wide{m};
+    return bit_width(c) <= k / 2 && plan_folds(m).folds != 0;
+}
+
+/*
+ * Reduction by folding, for pseudo-Mersenne moduli 2^k - c: values
+ * are kept as they are, and a product is folded a fixed number of
+ * times (see plan_folds) before a final subtraction
+ * With w the width of c, the first fold leaves at most k + w + 1
+ * bits, which the following ones work on; as w <= k / 2, the second
+ * takes the value below 2^k + c^2, and a third, when that isn't
+ * enough, below 2^k + c
+ * When c fits in a limb, folds are single-limb multiplications
+ */
+template <std::size_t size, typename limb, typename modulus>
+struct special_form_reduction {
+    using uint = static_uint<size, limb>;
+    using wide = static_uint<2 * size, limb>;
+
+    static constexpr uint m = modulus::value;
+    static constexpr unsigned int k = bit_width(m);
+    static constexpr uint c = truncate<size>(
+        (static_uint<size + 1, limb>{1} << k) -
+        static_uint<size + 1, limb>{m});
+    static constexpr bool c_fits_in_limb =
+        bit_width(c) <= sizeof(limb) * CHAR_BIT;
+    static constexpr fold_plan plan = plan_folds(m);
+    using folded = static_uint<plan.bits, limb>;
+
+    template <std::size_t from>
+    static constexpr folded fold(
+        static_uint<from, limb> const& value) noexcept {
+        auto const high = truncate<plan.bits>(value >> k);
+        auto const low = truncate<plan.bits>(truncate<k>(value));
+        if constexpr (c_fits_in_limb) {
+            return high * limb_access::get(c)[0] + low;
+        } else {
+            return high * truncate<plan.bits>(c) + low;
+        }
+    }
+    static constexpr uint reduce(wide const& value) noexcept {
+        auto result = fold(value);
+        for (unsigned int i = 1; i < plan.folds; ++i) {
+            result = fold(result);
+        }
+        constexpr auto folded_m = truncate<plan.bits>(m);
+        if (result >= folded_m) {
+            result -= folded_m;
+        }
+        return truncate<size>(result);
+    }
+    static constexpr uint mul(uint const& lhs,
+                              uint const& rhs) noexcept {
+        return reduce(mul_wide(lhs, rhs));
+    }
+    static constexpr uint to_rep(uint const& value) noexcept {
+        return value;
+    }
+    static constexpr uint from_rep(uint const& rep) noexcept {
+        return rep;
+    }
+    static constexpr uint from_product(uint const& product) noexcept {
+        return product;
+    }
+};
+
+/*
+ * Solinas moduli 2^k - c, where c is wider than for pseudo-Mersenne
+ * ones but made of a few signed powers of 2^32, like
+ * P-256 = 2^256 - 2^224 + 2^192 + 2^96 - 1 (c = 2^224 - 2^192 -
+ * 2^96 + 1) or P-224 = 2^224 - 2^96 + 1
+ * Values are then split into 32-bit columns, and 2^(k + 32j), the
+ * weight of the column j above 2^k, is congruent to a combination of
+ * the k / 32 columns below 2^k with small signed coefficients, found
+ * by substituting c for 2^k until no column is left above it
+ * c_columns and high_columns[j] hold those coefficients, for c and
+ * for 2^(k + 32j); valid is false if the modulus isn't of this form,
+ * or if the column sums could get too large
+ * offset is how many times m is added, spread over the columns, so
+ * that none of them goes negative (see solinas_reduction)
+ */
+inline constexpr std::size_t solinas_column_bits = 32;
+inline constexpr std::size_t max_solinas_terms = 8;
+inline constexpr std::int64_t max_solinas_column_sum = 1 << 20;
+
+template <std::size_t columns>
+struct solinas_form {
+    bool valid;
+    std::int64_t offset;
+    std::array<int, columns> c_columns;
+    std::array<std::array<int, columns>, columns> high_columns;
+};
+
+template <std::size_t size, typename limb>
+constexpr auto solinas_form_of(
+    static_uint<size, limb> const& m) noexcept {
+    constexpr auto columns =
+        (size + solinas_column_bits - 1) / solinas_column_bits;
+    auto form = solinas_form<columns>{false, 0, {}, {}};
+    auto const k = bit_width(m);
+    if (k % solinas_column_bits != 0) {
+        return form;
+    }
+    auto const n = k / solinas_column_bits;
+
+    // c in non-adjacent form, which has the fewest signed terms; the
+    // extra bits leave room for the carries of the negative ones
+    using wide = static_uint<size + 2, limb>;
+    auto c = (wide{1} << k) - wide{m};
+    std::size_t terms = 0;
+    for (unsigned int i = 0; c != 0; ++i, c >>= 1) {
+        if ((c & 1u) == 0) {
+            continue;
+        }
+        auto const negative = (c & 3u) == 3;
+        if (++terms > max_solinas_terms ||
+            i % solinas_column_bits != 0) {
+            return form;
+        }
+        form.c_columns[i / solinas_column_bits] = negative ? -1 : 1;
+        if (negative) {
+            c += 1u;
+        } else {
+            c -= 1u;
+        }
+    }
+
+    // sums of the positive and negative coefficients of each column
+    auto positive = std::array<std::int64_t, columns>{};
+    auto negative = std::array<std::int64_t, columns>{};
+    for (std::size_t j = 0; j < n; ++j) {
+        // 2^(k + 32j) = c * 2^(32j), then each column t >= n is
+        // replaced by c * 2^(32(t - n)), which only moves down
+        auto row = std::array<std::int64_t, 2 * columns>{};
+        for (std::size_t q = 0; q < n; ++q) {
+            row[q + j] = form.c_columns[q];
+        }
+        for (auto t = 2 * n; t-- > n;) {
+            for (std::size_t q = 0; q < n && row[t] != 0; ++q) {
+                row[q + t - n] += row[t] * form.c_columns[q];
+            }
+            row[t] = 0;
+        }
+        for (std::size_t q = 0; q < n; ++q) {
+            if (row[q] < 0) {
+                negative[q] -= row[q];
+            } else {
+                positive[q] += row[q];
+            }
+            if (positive[q] + negative[q] >= max_solinas_column_sum) {
+                return form;
+            }
+            form.high_columns[j][q] = static_cast<int>(row[q]);
+        }
+    }
+
+    // offset covers the most negative column; the columns then add
+    // up to less than (p + offset + 2) * 2^k, with p the largest sum
+    // of positive coefficients, which is the most the carry out of
+    // the top one can be, and folding it as carry * c must stay below
+    // 2m
+    std::int64_t largest_positive = 0;
+    for (std::size_t q = 0; q < n; ++q) {
+        if (negative[q] + 1 > form.offset) {
+            form.offset = negative[q] + 1;
+        }
+        if (positive[q] > largest_positive) {
+            largest_positive = positive[q];
+        }
+    }
+    auto const c_bound = (wide{1} << k) - wide{m};
+    auto const carry_bound = static_cast<std::size_t>(
+        largest_positive + form.offset + 4);
+    form.valid = c_bound * carry_bound < (wide{1} << k);
+    return form;
+}
+
+template <std::size_t size, typename limb>
+constexpr bool is_solinas_form(
+    static_uint<size, limb> const& m) noexcept {
+    return solinas_form_of(m).valid;
+}
+
+/*
+ * Reduction by column sums, for Solinas moduli (see solinas_form_of):
+ * values are kept as they are, and each 32-bit column of a product
+ * above 2^k is added, times its small coefficients, onto the columns
+ * below, in 64-bit sums, as the NIST fast reductions for P-256 and
+ * others do
+ * offset * m is added on the way, as offset * (2^32 - 1) on every
+ * column, offset on the lowest (which make up offset * 2^k) and minus
+ * offset * c, so that the columns stay nonnegative: normalising them
+ * to 32 bits is then a chain of shifts, and leaves a carry above 2^k,
+ * which is folded back as carry * c before a final subtraction
+ */
+template <std::size_t size, typename limb, typename modulus>
+struct solinas_reduction {
+    using uint = static_uint<size, limb>;
+    using wide = static_uint<2 * size, limb>;
+
+    static constexpr uint m = modulus::value;
+    static constexpr auto form = solinas_form_of(m);
+    static constexpr unsigned int k = bit_width(m);
+    static constexpr std::size_t n = k / solinas_column_bits;
+    static constexpr uint c = truncate<size>(
+        (static_uint<size + 1, limb>{1} << k) -
+        static_uint<size + 1, limb>{m});
+    static constexpr std::size_t limb_bits = sizeof(limb) * CHAR_BIT;
+    static constexpr std::uint64_t column_mask =
+        (std::uint64_t{1} << solinas_column_bits) - 1;
+
+    // wrapping arithmetic, since only the final sums are known to be
+    // nonnegative
+    using columns_type = std::array<std::uint64_t, n>;
+
+    static constexpr columns_type compute_bias() noexcept {
+        auto bias = columns_type{};
+        auto const offset = static_cast<std::uint64_t>(form.offset);
+        for (std::size_t q = 0; q < n; ++q) {
+            bias[q] = offset * (column_mask + (q == 0 ? 1 : 0)) -
+                      offset * static_cast<std::uint64_t>(
+                                   form.c_columns[q]);
+        }
+        return bias;
+    }
+    static constexpr columns_type bias = compute_bias();
+
+    static constexpr std::uint64_t column(wide const& value,
+                                          std::size_t i) noexcept {
+        auto const bit = i * solinas_column_bits;
+        return (limb_access::get(value)[bit / limb_bits] >>
+                (bit % limb_bits)) &
+               column_mask;
+    }
+
+    // unrolled over every (j, q) pair, so that the coefficients are
+    // constants and the zero ones drop out
+    template <std::size_t... is>
+    static constexpr void add_high_columns(
+        columns_type& columns, columns_type const& high,
+        std::index_sequence<is...>) noexcept {
+        constexpr auto const& coefficients = form.high_columns;
+        ((columns[is % n] +=
+          high[is / n] *
+          static_cast<std::uint64_t>(coefficients[is / n][is % n])),
+         ...);
+    }
+
+    static constexpr uint reduce(wide const& value) noexcept {
+        auto columns = bias;
+        auto high = columns_type{};
+        for (std::size_t q = 0; q < n; ++q) {
+            columns[q] += column(value, q);
+            high[q] = column(value, n + q);
+        }
+        add_high_columns(columns, high,
+                         std::make_index_sequence<n * n>());
+
+        auto low = uint{};
+        auto& limbs = limb_access::get(low);
+        std::uint64_t carry = 0;
+        for (std::size_t q = 0; q < n; ++q) {
+            columns[q] += carry;
+            carry = columns[q] >> solinas_column_bits;
+            auto const bit = q * solinas_column_bits;
+            limbs[bit / limb_bits] |=
+                static_cast<limb>(columns[q] & column_mask)
+                << (bit % limb_bits);
+        }
+        // low + carry * c, below 2m
+        auto [result, overflow] =
+            add_with_carry(low, c * static_cast<limb>(carry));
+        if (overflow || result >= m) {
+            result -= m;
+        }
+        return result;
+    }
+    static constexpr uint mul(uint const& lhs,
+                              uint const& rhs) noexcept {
+        return reduce(mul_wide(lhs, rhs));
+    }
+    static constexpr uint to_rep(uint const& value) noexcept {
+        return value;
+    }
+    static constexpr uint from_rep(uint const& rep) noexcept {
+        return rep;
+    }
+    static constexpr uint from_product(uint const& product) noexcept {
+        return product;
+    }
+};
+
+template <std::size_t size, typename limb, typename modulus>
+using reduction_for = std::conditional_t<
+    is_special_form(static_uint<size, limb>{modulus::value}),
+    special_form_reduction<size, limb, modulus>,
+    std::conditional_t<
+        is_solinas_form(static_uint<size, limb>{modulus::value}),
+        solinas_reduction<size, limb, modulus>,
+        std::conditional_t<(modulus::value & 1u) != 0,
+                           montgomery_reduction<size, limb, modulus>,
+                           barrett_reduction<size, limb, modulus>>>>;
+}  // namespace detail
+
+template <std::size_t size, typename modulus,
+          typename limb = std::uint64_t,
+          std::size_t guard_bits = sizeof(limb) * CHAR_BIT>
+struct mod_accumulator;
+
+/**
+ * mod_uint: an integer modulo a compile-time constant, with every
+ * operation reduced
+ * The modulus is given as a type with a static constexpr 'value'
+ * convertible to static_uint<size, limb>, eg.
+ *     struct p {
+ *         static constexpr auto value = static_uint<256>{...};
+ *     };
+ * Being a compile-time constant, all the reduction constants are
+ * computed during compilation and folded into the code
+ * Pseudo-Mersenne moduli 2^k - c with a small c are reduced by
+ * folding, Solinas ones whose c is a few signed powers of 2^32 (like
+ * P-256) by sums of 32-bit columns, other odd moduli use Montgomery
+ * form, and even ones Barrett reduction
+ */
+template <std::size_t size, typename modulus,
+          typename limb = std::uint64_t>
+struct mod_uint {
+    using uint = static_uint<size, limb>;
+
+  private:
+    using reduction = detail::reduction_for<size, limb, modulus>;
+
+    template <std::size_t, typename, typename, std::size_t>
+    friend struct mod_accumulator;
+
+    static_assert(uint{modulus::value} > 1,
+                  "The modulus must be greater than 1");
+
+    // the value in the reduction engine's representation, below the
+    // modulus
+    uint rep;
+
+    static constexpr mod_uint from_rep(uint const& in) noexcept {
+        auto result = mod_uint{};
+        result.rep = in;
+        return result;
+    }
+
+  public:
+    static constexpr uint modulus_value = modulus::value;
+
+    /**
+     * Constructors for default/value initialisation, and from
+     * integers which are reduced first
+     */
+    constexpr mod_uint() noexcept = default;
+    constexpr mod_uint(uint const& in) noexcept
+        : rep{reduction::to_rep(in % modulus_value)} {}
+    constexpr mod_uint(std::size_t in) noexcept
+        : mod_uint{uint{in}} {}
+
+    /**
+     * The value, between 0 and the modulus
+     */
+    constexpr uint value() const noexcept {
+        return reduction::from_rep(rep);
+    }
+
+    friend constexpr bool operator==(mod_uint const& lhs,
+                                     mod_uint const& rhs) noexcept {
+        return lhs.rep == rhs.rep;
+    }
+    friend constexpr bool operator!=(mod_uint const& lhs,
+                                     mod_uint const& rhs) noexcept {
+        return lhs.rep != rhs.rep;
+    }
+
+    // the representations are linear, so adding them needs no
+    // conversion
+    constexpr mod_uint& operator+=(mod_uint const& other) noexcept {
+        auto const [sum, carry_out] = add_with_carry(rep, other.rep);
+        rep = sum;
+        if (carry_out || rep >= modulus_value) {
+            rep -= modulus_value;
+        }
+        return *this;
+    }
+    friend constexpr mod_uint operator+(
+        mod_uint const& lhs, mod_uint const& rhs) noexcept {
+        auto result = lhs;
+        return result += rhs;
+    }
+    constexpr mod_uint& operator-=(mod_uint const& other) noexcept {
+        auto const [difference, borrow_out] =
+            sub_with_borrow(rep, other.rep);
+        rep = difference;
+        if (borrow_out) {
+            rep += modulus_value;
+        }
+        return *this;
+    }
+    friend constexpr mod_uint operator-(
+        mod_uint const& lhs, mod_uint const& rhs) noexcept {
+        auto result = lhs;
+        return result -= rhs;
+    }
+    friend constexpr mod_uint operator-(
+        mod_uint const& value) noexcept {
+        return mod_uint{} - value;
+    }
+
+    constexpr mod_uint& operator*=(mod_uint const& other) noexcept {
+        rep = reduction::mul(rep, other.rep);
+        return *this;
+    }
+    friend constexpr mod_uint operator*(
+        mod_uint const& lhs, mod_uint const& rhs) noexcept {
+        auto result = lhs;
+        return result *= rhs;
+    }
+
+    /**
+     * Exponentiation by squaring, from the most significant bit of
+     * the exponent
+     */
+    template <std::size_t exp_size>
+    constexpr mod_uint pow(
+        static_uint<exp_size, limb> const& exponent) const noexcept {
+        constexpr auto limb_bits = sizeof(limb) * CHAR_BIT;
+        auto const& limbs = detail::limb_access::get(exponent);
+        auto result = mod_uint{1};
+        for (auto bit = bit_width(exponent); bit != 0; --bit) {
+            auto const i = bit - 1;
+            result *= result;
+            if ((limbs[i / limb_bits] >> (i % limb_bits)) & 1) {
+                result *= *this;
+            }
+        }
+        return result;
+    }
+    constexpr mod_uint pow(std::size_t exponent) const noexcept {
+        return pow(static_uint<sizeof(std::size_t) * CHAR_BIT, limb>{
+            exponent});
+    }
+
+    /**
+     * Multiplicative inverse, by Fermat's little theorem: only valid
+     * for a prime modulus
+     * The inverse of 0 is 0
+     */
+    constexpr mod_uint inv() const noexcept {
+        return pow(modulus_value - 2);
+    }
+};
+
+/**
+ * mod_accumulator: a sum of mod_uint products, reduced only once when
+ * it is read
+ * Products are accumulated at full width with mac_into, on top of
+ * guard_bits extra bits, so up to 2^guard_bits of them can be added
+ * before the sum could overflow
+ */
+template <std::size_t size, typename modulus, typename limb,
+          std::size_t guard_bits>
+struct mod_accumulator {
+    using value_type = mod_uint<size, modulus, limb>;
+    using sum_type = static_uint<2 * size + guard_bits, limb>;
+
+  private:
+    using reduction = typename value_type::reduction;
+
+    sum_type sum{};
+
+  public:
+    constexpr mod_accumulator() noexcept = default;
+
+    // sum += lhs * rhs
+    constexpr void add_product(value_type const& lhs,
+                               value_type const& rhs) noexcept {
+        mac_into(sum, lhs.rep, rhs.rep);
+    }
+    // a product with one, so that it is scaled like the others
+    constexpr void add(value_type const& value) noexcept {
+        add_product(value, value_type{1});
+    }
+    constexpr void reset() noexcept { sum = sum_type{}; }
+
+    /**
+     * The reduced sum, going through a single division and the
+     * reduction engine's product conversion
+     */
+    constexpr value_type value() const noexcept {
+        auto const reduced = truncate<size>(
+            sum % sum_type{value_type::modulus_value});
+        return value_type::from_rep(reduction::from_product(reduced));
+    }
+};
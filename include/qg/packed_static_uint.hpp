@@ -0,0 +1,90 @@
+#pragma once
+
+#include <qg/static_uint.hpp>
+
+#include <array>
+#include <climits>
+#include <cstdint>
+
+/**
+ * packed_static_uint: storage-only counterpart to static_uint, taking
+ * exactly as many bytes as the value needs instead of a whole number
+ * of limbs (12 bytes rather than 16 for 96 bits)
+ * It has no arithmetic: values are loaded into a static_uint, worked
+ * on, and stored back
+ * Bytes are kept in little-endian order on every platform
+ */
+template <std::size_t size, typename limb = std::uint64_t>
+struct packed_static_uint {
+  private:
+    std::array<unsigned char, detail::required_sizeof(size)> bytes;
+
+  public:
+    using value_type = static_uint<size, limb>;
+
+    constexpr packed_static_uint() noexcept = default;
+    constexpr packed_static_uint(value_type const& value) noexcept
+        : bytes{} {
+        store(value);
+    }
+
+    /**
+     * Each limb is assembled from (or split into) its bytes with
+     * constant shifts, which GCC and clang merge into plain loads
+     * and stores on little-endian targets once the byte loop is
+     * unrolled (-O3)
+     */
+    constexpr value_type load() const noexcept {
+        auto result = value_type{};
+        auto& limbs = detail::limb_access::get(result);
+        for (std::size_t i = 0; i < limbs.size(); ++i) {
+            auto value = limb{0};
+            for (std::size_t j = 0; j < sizeof(limb); ++j) {
+                auto const byte = i * sizeof(limb) + j;
+                if (byte < bytes.size()) {
+                    value |= static_cast<limb>(bytes[byte])
+                             << (j * CHAR_BIT);
+                }
+            }
+            limbs[i] = value;
+        }
+        return result;
+    }
+    constexpr void store(value_type const& value) noexcept {
+        auto const& limbs = detail::limb_access::get(value);
+        for (std::size_t i = 0; i < limbs.size(); ++i) {
+            for (std::size_t j = 0; j < sizeof(limb); ++j) {
+                auto const byte = i * sizeof(limb) + j;
+                if (byte < bytes.size()) {
+                    bytes[byte] = static_cast<unsigned char>(
+                        limbs[i] >> (j * CHAR_BIT));
+                }
+            }
+        }
+    }
+
+    constexpr operator value_type() const noexcept { return load(); }
+};
+
+/**
+ * Bulk conversions between arrays of packed values and of
+ * (limb-aligned) static_uints
+ * Both return the end of the output range, like std::copy
+ */
+template <typename InputIt, typename OutputIt>
+constexpr OutputIt unpack(InputIt first, InputIt last,
+                          OutputIt out) noexcept {
+    for (; first != last; ++first, ++out) {
+        *out = first->load();
+    }
+    return out;
+}
+
+template <typename InputIt, typename OutputIt>
+constexpr OutputIt pack(InputIt first, InputIt last,
+                        OutputIt out) noexcept {
+    for (; first != last; ++first, ++out) {
+        out->store(*first);
+    }
+    return out;
+}
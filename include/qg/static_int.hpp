@@ -0,0 +1,275 @@
+#pragma once
+
+#include <qg/static_uint.hpp>
+
+#include <climits>
+#include <cstdint>
+#include <limits>
+
+/**
+ * static_int: a signed integer parameterized by its bit size
+ * The value is stored in two's complement in a static_uint of the
+ * same size, so addition, subtraction, multiplication and the bitwise
+ * operations are exactly the unsigned limb kernels, and only
+ * comparisons, right shifts and division look at the sign
+ * Converting to and from the static_uint of the same size keeps the
+ * bits as they are
+ */
+template <std::size_t size, typename limb = std::uint64_t>
+struct static_int {
+  private:
+    static_uint<size, limb> bits;
+
+  public:
+    using unsigned_type = static_uint<size, limb>;
+    using limb_type = limb;
+
+    /**
+     * Constructors for default/value initialisation and
+     * initialisation from platform-sized signed integers, which are
+     * sign-extended
+     */
+    constexpr static_int() noexcept = default;
+    constexpr static_int(std::int64_t in) noexcept
+        : bits{static_cast<std::size_t>(in < 0 ? ~in : in)} {
+        if (in < 0) {
+            bits = ~bits;
+        }
+    }
+
+    /**
+     * Reinterpretation as and from the unsigned type of the same size
+     */
+    constexpr explicit static_int(unsigned_type const& in) noexcept
+        : bits{in} {}
+    constexpr explicit operator unsigned_type() const noexcept {
+        return bits;
+    }
+    constexpr unsigned_type const& to_unsigned() const noexcept {
+        return bits;
+    }
+
+    /**
+     * Sign, read from the top bit of the most significant limb
+     */
+    constexpr bool is_negative() const noexcept {
+        constexpr auto limb_bits = sizeof(limb) * CHAR_BIT;
+        auto const& limbs = detail::limb_access::get(bits);
+        return (limbs.back() >> ((size - 1) % limb_bits)) & 1;
+    }
+
+    // comparisons
+    friend constexpr int compare(static_int const& lhs,
+                                 static_int const& rhs) noexcept {
+        auto const lhs_negative = lhs.is_negative();
+        if (lhs_negative != rhs.is_negative()) {
+            return lhs_negative ? -1 : 1;
+        }
+        // with the same sign, two's complement orders like unsigned
+        return compare(lhs.bits, rhs.bits);
+    }
+    friend constexpr bool operator==(static_int const& lhs,
+                                     static_int const& rhs) noexcept {
+        return lhs.bits == rhs.bits;
+    }
+    friend constexpr bool operator!=(static_int const& lhs,
+                                     static_int const& rhs) noexcept {
+        return lhs.bits != rhs.bits;
+    }
+    friend constexpr bool operator<(static_int const& lhs,
+                                    static_int const& rhs) noexcept {
+        return compare(lhs, rhs) < 0;
+    }
+    friend constexpr bool operator>(static_int const& lhs,
+                                    static_int const& rhs) noexcept {
+        return compare(lhs, rhs) > 0;
+    }
+    friend constexpr bool operator<=(static_int const& lhs,
+                                     static_int const& rhs) noexcept {
+        return compare(lhs, rhs) <= 0;
+    }
+    friend constexpr bool operator>=(static_int const& lhs,
+                                     static_int const& rhs) noexcept {
+        return compare(lhs, rhs) >= 0;
+    }
+
+    // arithmetic, wrapping around like the unsigned type
+    friend constexpr static_int operator-(
+        static_int const& value) noexcept {
+        return static_int{unsigned_type{} - value.bits};
+    }
+    constexpr static_int& operator+=(
+        static_int const& other) noexcept {
+        bits += other.bits;
+        return *this;
+    }
+    friend constexpr static_int operator+(
+        static_int const& lhs, static_int const& rhs) noexcept {
+        auto result = lhs;
+        return result += rhs;
+    }
+    constexpr static_int& operator-=(
+        static_int const& other) noexcept {
+        bits -= other.bits;
+        return *this;
+    }
+    friend constexpr static_int operator-(
+        static_int const& lhs, static_int const& rhs) noexcept {
+        auto result = lhs;
+        return result -= rhs;
+    }
+    // the truncated two's complement product is the unsigned one
+    constexpr static_int& operator*=(
+        static_int const& other) noexcept {
+        bits *= other.bits;
+        return *this;
+    }
+    friend constexpr static_int operator*(
+        static_int const& lhs, static_int const& rhs) noexcept {
+        auto result = lhs;
+        return result *= rhs;
+    }
+
+    constexpr static_int& operator++() noexcept {
+        ++bits;
+        return *this;
+    }
+    constexpr static_int operator++(int) noexcept {
+        auto result = *this;
+        ++bits;
+        return result;
+    }
+    constexpr static_int& operator--() noexcept {
+        --bits;
+        return *this;
+    }
+    constexpr static_int operator--(int) noexcept {
+        auto result = *this;
+        --bits;
+        return result;
+    }
+
+    /**
+     * Division, truncating towards zero like for built-in integers
+     * The magnitudes go through the unsigned division, and the signs
+     * are applied afterwards
+     */
+    friend constexpr divmod_result<static_int> divmod(
+        static_int const& lhs, static_int const& rhs) noexcept {
+        auto const lhs_negative = lhs.is_negative();
+        auto const rhs_negative = rhs.is_negative();
+        auto const [quotient, remainder] =
+            divmod(lhs_negative ? (-lhs).bits : lhs.bits,
+                   rhs_negative ? (-rhs).bits : rhs.bits);
+        auto result = divmod_result<static_int>{
+            static_int{quotient}, static_int{remainder}};
+        if (lhs_negative != rhs_negative) {
+            result.quotient = -result.quotient;
+        }
+        // the remainder takes the sign of the dividend
+        if (lhs_negative) {
+            result.remainder = -result.remainder;
+        }
+        return result;
+    }
+    constexpr static_int& operator/=(
+        static_int const& other) noexcept {
+        return *this = divmod(*this, other).quotient;
+    }
+    friend constexpr static_int operator/(
+        static_int const& lhs, static_int const& rhs) noexcept {
+        return divmod(lhs, rhs).quotient;
+    }
+    constexpr static_int& operator%=(
+        static_int const& other) noexcept {
+        return *this = divmod(*this, other).remainder;
+    }
+    friend constexpr static_int operator%(
+        static_int const& lhs, static_int const& rhs) noexcept {
+        return divmod(lhs, rhs).remainder;
+    }
+
+    // bitwise operations
+    constexpr static_int& operator&=(
+        static_int const& rhs) noexcept {
+        bits &= rhs.bits;
+        return *this;
+    }
+    friend constexpr static_int operator&(
+        static_int const& lhs, static_int const& rhs) noexcept {
+        auto result = lhs;
+        return result &= rhs;
+    }
+    constexpr static_int& operator|=(
+        static_int const& rhs) noexcept {
+        bits |= rhs.bits;
+        return *this;
+    }
+    friend constexpr static_int operator|(
+        static_int const& lhs, static_int const& rhs) noexcept {
+        auto result = lhs;
+        return result |= rhs;
+    }
+    constexpr static_int& operator^=(
+        static_int const& rhs) noexcept {
+        bits ^= rhs.bits;
+        return *this;
+    }
+    friend constexpr static_int operator^(
+        static_int const& lhs, static_int const& rhs) noexcept {
+        auto result = lhs;
+        return result ^= rhs;
+    }
+    friend constexpr static_int operator~(
+        static_int const& value) noexcept {
+        return static_int{~value.bits};
+    }
+
+    constexpr static_int& operator<<=(unsigned int shift) noexcept {
+        bits <<= shift;
+        return *this;
+    }
+    friend constexpr static_int operator<<(
+        static_int const& lhs, unsigned int shift) noexcept {
+        auto result = lhs;
+        return result <<= shift;
+    }
+
+    /**
+     * Arithmetic right shift, rounding towards negative infinity
+     * Negative values are complemented around a logical shift, which
+     * fills the vacated bits with ones
+     */
+    constexpr static_int& operator>>=(unsigned int shift) noexcept {
+        if (is_negative()) {
+            bits = ~(~bits >> shift);
+        } else {
+            bits >>= shift;
+        }
+        return *this;
+    }
+    friend constexpr static_int operator>>(
+        static_int const& lhs, unsigned int shift) noexcept {
+        auto result = lhs;
+        return result >>= shift;
+    }
+};
+
+namespace std {
+// NOTE(quentin): this is not a full specialisation, which
+// isn't ideal
+template <std::size_t size, typename limb>
+struct numeric_limits<static_int<size, limb>> {
+    static constexpr bool is_specialized() noexcept { return true; }
+    static constexpr bool is_integer() noexcept { return true; }
+    static constexpr bool is_exact() noexcept { return true; }
+    static constexpr bool is_signed() noexcept { return true; }
+    static constexpr static_int<size, limb> max() noexcept {
+        return static_int<size, limb>{
+            numeric_limits<static_uint<size, limb>>::max() >> 1};
+    }
+    static constexpr static_int<size, limb> min() noexcept {
+        return ~max();
+    }
+};
+}  // namespace std
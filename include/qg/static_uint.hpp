@@ -6,8 +6,14 @@
 
 #include <array>
 #include <cassert>
+#include <charconv>
 #include <climits>
+#include <cmath>
 #include <cstdint>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <utility>
 
 namespace detail {
 /*
@@ -23,16 +29,43 @@ constexpr inline std::size_t required_sizeof(
 }
 
 /*
- * Compute the array size required, based on the platform's size_t
- * size
+ * Compute the array size required, based on the limb size
  */
 constexpr inline std::size_t required_array_size(
-    std::size_t size_in_bits) noexcept {
+    std::size_t size_in_bits, std::size_t limb_size) noexcept {
     auto const required = required_sizeof(size_in_bits);
-    if (required % sizeof(std::size_t) == 0) {
-        return required / sizeof(std::size_t);
+    if (required % limb_size == 0) {
+        return required / limb_size;
+    } else {
+        return required / limb_size + 1;
+    }
+}
+
+/*
+ * Mask of the bits of the most significant limb that are part of the
+ * value, for sizes that aren't a multiple of the limb size
+ */
+template <typename limb>
+constexpr limb top_limb_mask(std::size_t size_in_bits) noexcept {
+    constexpr auto limb_bits = sizeof(limb) * CHAR_BIT;
+    auto const top_bits = size_in_bits % limb_bits;
+    if (top_bits == 0) {
+        return static_cast<limb>(~limb{0});
     } else {
-        return required / sizeof(std::size_t) + 1;
+        return (limb{1} << top_bits) - 1;
+    }
+}
+
+/*
+ * Clear the bits of the most significant limb that are past the
+ * value's size, giving wrap-around semantics at exactly 'size' bits
+ * Compiles to nothing when the top limb is fully used
+ */
+template <std::size_t size, typename limb, std::size_t n>
+constexpr void mask_top_limb(std::array<limb, n>& data) noexcept {
+    constexpr auto mask = top_limb_mask<limb>(size);
+    if constexpr (mask != static_cast<limb>(~limb{0})) {
+        data[n - 1] &= mask;
     }
 }
 
@@ -43,86 +76,761 @@ constexpr inline std::size_t required_array_size(
  * endianness
  */
 #if BOOST_ENDIAN_BIG_BYTE
-template <std::size_t bigger_size, std::size_t smaller_size,
-          std::size_t... zeros, std::size_t... is>
-constexpr std::array<std::size_t, bigger_size> widen_array_impl(
-    std::array<std::size_t, smaller_size> const& small_array,
+template <std::size_t bigger_size, typename limb,
+          std::size_t smaller_size, std::size_t... zeros,
+          std::size_t... is>
+constexpr std::array<limb, bigger_size> widen_array_impl(
+    std::array<limb, smaller_size> const& small_array,
     std::index_sequence<zeros...>,
     std::index_sequence<is...>) noexcept {
-    return {((void)zeros, 0)..., (small_array[is])...};
+    return {((void)zeros, limb{0})..., (small_array[is])...};
 }
 
-template <std::size_t bigger_size, std::size_t smaller_size>
-constexpr std::array<std::size_t, bigger_size> widen_array(
-    std::array<std::size_t, smaller_size> const&
-        small_array) noexcept {
+template <std::size_t bigger_size, typename limb,
+          std::size_t smaller_size>
+constexpr std::array<limb, bigger_size> widen_array(
+    std::array<limb, smaller_size> const& small_array) noexcept {
     constexpr auto z =
         std::make_index_sequence<bigger_size - smaller_size>();
     constexpr auto l = std::make_index_sequence<smaller_size>();
     return widen_array_impl<bigger_size>(small_array, z, l);
 }
 #elif BOOST_ENDIAN_LITTLE_BYTE
-template <std::size_t bigger_size, std::size_t smaller_size,
-          std::size_t... is>
-constexpr std::array<std::size_t, bigger_size> widen_array_impl(
-    std::array<std::size_t, smaller_size> const& small_array,
+template <std::size_t bigger_size, typename limb,
+          std::size_t smaller_size, std::size_t... is>
+constexpr std::array<limb, bigger_size> widen_array_impl(
+    std::array<limb, smaller_size> const& small_array,
     std::index_sequence<is...>) noexcept {
     return {(small_array[is])...};
 }
 
-template <std::size_t bigger_size, std::size_t smaller_size>
-constexpr std::array<std::size_t, bigger_size> widen_array(
-    std::array<std::size_t, smaller_size> const&
-        small_array) noexcept {
+template <std::size_t bigger_size, typename limb,
+          std::size_t smaller_size>
+constexpr std::array<limb, bigger_size> widen_array(
+    std::array<limb, smaller_size> const& small_array) noexcept {
     constexpr auto l = std::make_index_sequence<smaller_size>();
     return widen_array_impl<bigger_size>(small_array, l);
 }
 #endif
+
+/*
+ * Split a built-in unsigned integer into n limbs, in the order
+ * widen_array expects, dropping the limbs that don't fit
+ */
+template <std::size_t n, typename limb, typename T>
+constexpr std::array<limb, n> scalar_to_limbs(T in) noexcept {
+    constexpr auto count =
+        (sizeof(T) + sizeof(limb) - 1) / sizeof(limb);
+    if constexpr (count == 1) {
+        return widen_array<n>(std::array{static_cast<limb>(in)});
+    } else {
+        constexpr auto limb_bits = sizeof(limb) * CHAR_BIT;
+        auto result = std::array<limb, n>{};
+        for (std::size_t i = 0; i < count && i < n; ++i) {
+#if BOOST_ENDIAN_BIG_BYTE
+            result[n - 1 - i] =
+                static_cast<limb>(in >> (i * limb_bits));
+#elif BOOST_ENDIAN_LITTLE_BYTE
+            result[i] = static_cast<limb>(in >> (i * limb_bits));
+#endif
+        }
+        return result;
+    }
+}
+
+/*
+ * Number of bits needed to represent n
+ */
+constexpr inline std::size_t bits_needed(std::size_t n) noexcept {
+    std::size_t bits = 0;
+    for (; n != 0; n >>= 1) {
+        ++bits;
+    }
+    return bits;
+}
+
+/*
+ * Native unsigned integer of exactly 'bytes' bytes, void if there is
+ * none
+ */
+template <std::size_t bytes>
+struct native_uint {
+    using type = void;
+};
+template <>
+struct native_uint<sizeof(std::uint64_t)> {
+    using type = std::uint64_t;
+};
+#if defined(__SIZEOF_INT128__)
+template <>
+struct native_uint<2 * sizeof(std::uint64_t)> {
+    __extension__ using type = unsigned __int128;
+};
+#endif
+template <std::size_t bytes>
+using native_uint_t = typename native_uint<bytes>::type;
+
+/*
+ * Built-in integers that fit in a single limb
+ * Operators taking those can skip building a full-width static_uint
+ */
+template <typename T, typename limb>
+constexpr bool fits_in_limb_v =
+    std::is_integral_v<T> && sizeof(T) <= sizeof(limb);
+
+/*
+ * Double-width product of two limbs, returning the low half and
+ * storing the high half in 'hi'
+ */
+template <typename limb>
+constexpr limb mul_wide(limb a, limb b, limb& hi) noexcept {
+    constexpr auto limb_bits = sizeof(limb) * CHAR_BIT;
+    if constexpr (2 * sizeof(limb) <= sizeof(std::uint64_t)) {
+        auto const product = static_cast<std::uint64_t>(a) * b;
+        hi = static_cast<limb>(product >> limb_bits);
+        return static_cast<limb>(product);
+    }
+#if defined(__SIZEOF_INT128__)
+    if constexpr (sizeof(limb) <= sizeof(std::uint64_t)) {
+        __extension__ using wide = unsigned __int128;
+        auto const product = static_cast<wide>(a) * b;
+        hi = static_cast<limb>(product >> limb_bits);
+        return static_cast<limb>(product);
+    }
+#endif
+    constexpr auto half_bits = limb_bits / 2;
+    constexpr auto half_mask = (limb{1} << half_bits) - 1;
+    auto const a_lo = a & half_mask;
+    auto const a_hi = a >> half_bits;
+    auto const b_lo = b & half_mask;
+    auto const b_hi = b >> half_bits;
+
+    auto const lo_lo = a_lo * b_lo;
+    auto const lo_hi = a_lo * b_hi;
+    auto const hi_lo = a_hi * b_lo;
+    auto const mid = (lo_lo >> half_bits) + (lo_hi & half_mask) +
+                     (hi_lo & half_mask);
+    hi = a_hi * b_hi + (lo_hi >> half_bits) + (hi_lo >> half_bits) +
+         (mid >> half_bits);
+    return (mid << half_bits) | (lo_lo & half_mask);
+}
+
+/*
+ * Single limb addition and subtraction, with carry/borrow in and out
+ */
+template <typename limb>
+constexpr limb add_carry(limb a, limb b, bool& carry) noexcept {
+    limb const sum = a + b;
+    limb const result = sum + (carry ? 1 : 0);
+    carry = sum < a || result < sum;
+    return result;
+}
+template <typename limb>
+constexpr limb sub_borrow(limb a, limb b, bool& borrow) noexcept {
+    limb const diff = a - b;
+    limb const result = diff - (borrow ? 1 : 0);
+    borrow = a < b || diff < result;
+    return result;
+}
+
+/*
+ * Limb array kernels
+ * Arrays are ordered from least to most significant limb, and the
+ * kernels only touch the limbs they are given: a narrower operand
+ * is never widened to the destination's size
+ */
+
+/*
+ * dst[0, n) += src[0, m) + carry, with m <= n
+ * Carry propagation past src stops as soon as a limb doesn't wrap
+ * Returns the carry out of the top limb
+ */
+template <typename limb>
+constexpr bool add_limbs(limb* dst, std::size_t n, limb const* src,
+                         std::size_t m, bool carry = false) noexcept {
+    std::size_t i = 0;
+    for (; i < m; ++i) {
+        dst[i] = add_carry(dst[i], src[i], carry);
+    }
+    for (; carry && i < n; ++i) {
+        carry = ++dst[i] == 0;
+    }
+    return carry;
+}
+
+/*
+ * dst[0, n) = a[0, n) + b[0, n) and dst[0, n) = a[0, n) - b[0, n)
+ * Each limb is read before being written, so dst may alias a or b
+ * Return the carry/borrow out of the top limb
+ */
+template <typename limb>
+constexpr bool add_limbs_to(limb* dst, limb const* a, limb const* b,
+                            std::size_t n) noexcept {
+    bool carry = false;
+    for (std::size_t i = 0; i < n; ++i) {
+        dst[i] = add_carry(a[i], b[i], carry);
+    }
+    return carry;
+}
+template <typename limb>
+constexpr bool sub_limbs_to(limb* dst, limb const* a, limb const* b,
+                            std::size_t n) noexcept {
+    bool borrow = false;
+    for (std::size_t i = 0; i < n; ++i) {
+        dst[i] = sub_borrow(a[i], b[i], borrow);
+    }
+    return borrow;
+}
+
+/*
+ * dst[0, n) -= src[0, m) + borrow, with m <= n
+ * Returns the borrow out of the top limb
+ */
+template <typename limb>
+constexpr bool sub_limbs(limb* dst, std::size_t n, limb const* src,
+                         std::size_t m,
+                         bool borrow = false) noexcept {
+    std::size_t i = 0;
+    for (; i < m; ++i) {
+        dst[i] = sub_borrow(dst[i], src[i], borrow);
+    }
+    for (; borrow && i < n; ++i) {
+        borrow = dst[i]-- == 0;
+    }
+    return borrow;
+}
+
+/*
+ * dst[0, n) *= v
+ * Returns the limb carried out of the top limb
+ */
+template <typename limb>
+constexpr limb mul_limb(limb* dst, std::size_t n, limb v) noexcept {
+    limb carry = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        limb hi = 0;
+        limb lo = mul_wide(dst[i], v, hi);
+        lo += carry;
+        hi += lo < carry ? 1 : 0;
+        dst[i] = lo;
+        carry = hi;
+    }
+    return carry;
+}
+
+/*
+ * dst[0, m) += src[0, m) * v
+ * Returns the limb carried out of dst[m - 1]
+ */
+template <typename limb>
+constexpr limb addmul_limb(limb* dst, limb const* src, std::size_t m,
+                           limb v) noexcept {
+    limb carry = 0;
+    for (std::size_t j = 0; j < m; ++j) {
+        limb hi = 0;
+        limb lo = mul_wide(src[j], v, hi);
+        lo += carry;
+        hi += lo < carry ? 1 : 0;
+        dst[j] += lo;
+        hi += dst[j] < lo ? 1 : 0;
+        carry = hi;
+    }
+    return carry;
+}
+
+/*
+ * dst[0, n) = a[0, na) * b[0, nb), truncated to n limbs
+ * dst must not alias a or b
+ * With detect_overflow, returns whether any nonzero bits of the
+ * product were truncated
+ */
+template <bool detect_overflow = false, typename limb>
+constexpr bool mul_limbs(limb* dst, std::size_t n, limb const* a,
+                         std::size_t na, limb const* b,
+                         std::size_t nb) noexcept {
+    for (std::size_t i = 0; i < n; ++i) {
+        dst[i] = 0;
+    }
+    bool overflow = false;
+    // past n, rows only matter for detecting overflow
+    for (std::size_t i = 0; i < na && (detect_overflow || i < n);
+         ++i) {
+        auto const m = i < n ? (nb < n - i ? nb : n - i) : 0;
+        auto const carry = addmul_limb(dst + i, b, m, a[i]);
+        // previous rows never reach past i + nb - 1
+        if (i + m < n) {
+            dst[i + m] = carry;
+        } else if constexpr (detect_overflow) {
+            overflow = overflow || carry != 0;
+            for (auto j = m; a[i] != 0 && j < nb; ++j) {
+                overflow = overflow || b[j] != 0;
+            }
+        }
+    }
+    return overflow;
+}
+
+/*
+ * dst[0, n) += a[0, na) * b[0, nb), truncated to n limbs
+ * Each row of the product is accumulated straight into dst, so the
+ * addend is part of the multiplication's carry chain
+ * dst must not alias a or b
+ */
+template <typename limb>
+constexpr void mul_add_limbs(limb* dst, std::size_t n, limb const* a,
+                             std::size_t na, limb const* b,
+                             std::size_t nb) noexcept {
+    for (std::size_t i = 0; i < na && i < n; ++i) {
+        auto const m = nb < n - i ? nb : n - i;
+        auto const carry = addmul_limb(dst + i, b, m, a[i]);
+        if (i + m < n) {
+            add_limbs(dst + i + m, n - i - m, &carry, 1);
+        }
+    }
+}
+
+/*
+ * Three-way comparison of a[0, na) and b[0, nb)
+ */
+template <typename limb>
+constexpr int compare_limbs(limb const* a, std::size_t na,
+                            limb const* b, std::size_t nb) noexcept {
+    for (std::size_t i = na; i > nb; --i) {
+        if (a[i - 1] != 0) {
+            return 1;
+        }
+    }
+    for (std::size_t i = nb; i > na; --i) {
+        if (b[i - 1] != 0) {
+            return -1;
+        }
+    }
+    for (std::size_t i = na < nb ? na : nb; i != 0; --i) {
+        if (a[i - 1] > b[i - 1]) {
+            return 1;
+        }
+        if (a[i - 1] < b[i - 1]) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/*
+ * Number of leading zero bits of a limb, which must not be zero
+ */
+template <typename limb>
+constexpr unsigned int countl_zero_limb(limb x) noexcept {
+    constexpr auto limb_bits = sizeof(limb) * CHAR_BIT;
+#if defined(__GNUC__)
+    if constexpr (sizeof(limb) <= sizeof(unsigned long long)) {
+        using ull = unsigned long long;
+        constexpr auto ull_bits = sizeof(ull) * CHAR_BIT;
+        return static_cast<unsigned int>(
+            __builtin_clzll(static_cast<ull>(x)) -
+            (ull_bits - limb_bits));
+    }
+#endif
+    unsigned int count = 0;
+    for (auto bit = limb{1} << (limb_bits - 1); (x & bit) == 0;
+         bit >>= 1) {
+        ++count;
+    }
+    return count;
+}
+
+/*
+ * Quotient of the double-width hi:lo by d, storing the remainder in
+ * 'rem', with hi < d so that the quotient fits in a limb
+ * Without a native double-width division, this is the half-limb
+ * long division from Hacker's Delight (divlu)
+ */
+template <typename limb>
+constexpr limb div_wide(limb hi, limb lo, limb d,
+                        limb& rem) noexcept {
+    constexpr auto limb_bits = sizeof(limb) * CHAR_BIT;
+    if constexpr (2 * sizeof(limb) <= sizeof(std::uint64_t)) {
+        auto const n =
+            (static_cast<std::uint64_t>(hi) << limb_bits) | lo;
+        rem = static_cast<limb>(n % d);
+        return static_cast<limb>(n / d);
+    }
+#if defined(__SIZEOF_INT128__)
+    if constexpr (sizeof(limb) <= sizeof(std::uint64_t)) {
+        __extension__ using wide = unsigned __int128;
+        auto const n = (static_cast<wide>(hi) << limb_bits) | lo;
+        rem = static_cast<limb>(n % d);
+        return static_cast<limb>(n / d);
+    }
+#endif
+    constexpr auto half_bits = limb_bits / 2;
+    constexpr auto half = limb{1} << half_bits;
+    constexpr auto half_mask = half - 1;
+
+    // normalize so that the top bit of d is set
+    auto const s = countl_zero_limb(d);
+    d <<= s;
+    auto const d1 = d >> half_bits;
+    auto const d0 = d & half_mask;
+    auto const n32 = s == 0 ? hi
+                            : (hi << s) | (lo >> (limb_bits - s));
+    auto const n10 = lo << s;
+    auto const n1 = n10 >> half_bits;
+    auto const n0 = n10 & half_mask;
+
+    // each half of the quotient is estimated from the top half of d,
+    // then corrected (at most twice)
+    auto q1 = n32 / d1;
+    auto r = n32 - q1 * d1;
+    while (q1 >= half || q1 * d0 > ((r << half_bits) | n1)) {
+        --q1;
+        r += d1;
+        if (r >= half) {
+            break;
+        }
+    }
+    auto const n21 = (n32 << half_bits) + n1 - q1 * d;
+
+    auto q0 = n21 / d1;
+    r = n21 - q0 * d1;
+    while (q0 >= half || q0 * d0 > ((r << half_bits) | n0)) {
+        --q0;
+        r += d1;
+        if (r >= half) {
+            break;
+        }
+    }
+    rem = ((n21 << half_bits) + n0 - q0 * d) >> s;
+    return (q1 << half_bits) | q0;
+}
+
+/*
+ * dst[0, m) -= src[0, m) * v
+ * Returns the limb borrowed from past dst[m - 1]
+ */
+template <typename limb>
+constexpr limb submul_limb(limb* dst, limb const* src, std::size_t m,
+                           limb v) noexcept {
+    limb borrow = 0;
+    for (std::size_t j = 0; j < m; ++j) {
+        limb hi = 0;
+        limb lo = mul_wide(src[j], v, hi);
+        lo += borrow;
+        hi += lo < borrow ? 1 : 0;
+        hi += dst[j] < lo ? 1 : 0;
+        dst[j] -= lo;
+        borrow = hi;
+    }
+    return borrow;
+}
+
+/*
+ * q[0, n) = a[0, n) / d, returning the remainder
+ * q may alias a
+ */
+template <typename limb>
+constexpr limb div_limb(limb* q, limb const* a, std::size_t n,
+                        limb d) noexcept {
+    limb rem = 0;
+    for (std::size_t i = n; i != 0; --i) {
+        q[i - 1] = div_wide(rem, a[i - 1], d, rem);
+    }
+    return rem;
+}
+
+/*
+ * dst[0, n) <<= shift and dst[0, n) = src[0, n) >> shift, with shift
+ * smaller than the total number of bits
+ * The right shift reads each limb before writing it, so dst may be
+ * src
+ */
+template <typename limb>
+constexpr void shl_limbs(limb* dst, std::size_t n,
+                         unsigned int shift) noexcept {
+    constexpr auto limb_bits = sizeof(limb) * CHAR_BIT;
+    auto const limb_shift = shift / limb_bits;
+    auto const bit_shift = shift % limb_bits;
+    for (std::size_t i = n; i-- > limb_shift;) {
+        auto const src = i - limb_shift;
+        auto value = static_cast<limb>(dst[src] << bit_shift);
+        if (bit_shift != 0 && src > 0) {
+            value |= dst[src - 1] >> (limb_bits - bit_shift);
+        }
+        dst[i] = value;
+    }
+    for (std::size_t i = 0; i < limb_shift; ++i) {
+        dst[i] = 0;
+    }
+}
+template <typename limb>
+constexpr void shr_limbs(limb* dst, limb const* src, std::size_t n,
+                         unsigned int shift) noexcept {
+    constexpr auto limb_bits = sizeof(limb) * CHAR_BIT;
+    auto const limb_shift = shift / limb_bits;
+    auto const bit_shift = shift % limb_bits;
+    for (std::size_t i = 0; i + limb_shift < n; ++i) {
+        auto const j = i + limb_shift;
+        auto value = static_cast<limb>(src[j] >> bit_shift);
+        if (bit_shift != 0 && j + 1 < n) {
+            value |= src[j + 1] << (limb_bits - bit_shift);
+        }
+        dst[i] = value;
+    }
+    for (std::size_t i = n - limb_shift; i < n; ++i) {
+        dst[i] = 0;
+    }
+}
+
+/*
+ * Schoolbook long division (Knuth's algorithm D)
+ * q[0, na - nb + 1) = a[0, na) / b[0, nb) and r[0, nb) the remainder,
+ * with nb >= 2, na >= nb and a nonzero b[nb - 1]
+ * 'un' (na + 1 limbs) and 'vn' (nb limbs) are scratch space, so that
+ * the kernel doesn't need to allocate
+ */
+template <typename limb>
+constexpr void div_limbs(limb* q, limb* r, limb const* a,
+                         std::size_t na, limb const* b,
+                         std::size_t nb, limb* un,
+                         limb* vn) noexcept {
+    // normalize so that the divisor's top bit is set, which keeps
+    // each quotient limb estimate at most 2 above the real one
+    auto const s = countl_zero_limb(b[nb - 1]);
+    for (std::size_t i = 0; i < nb; ++i) {
+        vn[i] = b[i];
+    }
+    shl_limbs(vn, nb, s);
+    for (std::size_t i = 0; i < na; ++i) {
+        un[i] = a[i];
+    }
+    un[na] = 0;
+    shl_limbs(un, na + 1, s);
+
+    auto const v1 = vn[nb - 1];
+    auto const v2 = vn[nb - 2];
+    for (std::size_t j = na - nb + 1; j-- > 0;) {
+        auto const u0 = un[j + nb];
+        auto const u1 = un[j + nb - 1];
+        auto const u2 = un[j + nb - 2];
+
+        limb qhat = 0;
+        limb rhat = 0;
+        bool rhat_overflow = false;
+        if (u0 >= v1) {
+            qhat = static_cast<limb>(~limb{0});
+            rhat = u1 + v1;
+            rhat_overflow = rhat < u1;
+        } else {
+            qhat = div_wide(u0, u1, v1, rhat);
+        }
+        while (!rhat_overflow) {
+            limb p_hi = 0;
+            auto const p_lo = mul_wide(qhat, v2, p_hi);
+            if (p_hi < rhat || (p_hi == rhat && p_lo <= u2)) {
+                break;
+            }
+            --qhat;
+            auto const previous = rhat;
+            rhat += v1;
+            rhat_overflow = rhat < previous;
+        }
+
+        auto const borrow = submul_limb(un + j, vn, nb, qhat);
+        auto const top = un[j + nb];
+        un[j + nb] = top - borrow;
+        if (top < borrow) {
+            // the estimate was still one too large
+            --qhat;
+            add_limbs(un + j, nb + 1, vn, nb);
+        }
+        q[j] = qhat;
+    }
+
+    shr_limbs(un, un, nb, s);
+    for (std::size_t i = 0; i < nb; ++i) {
+        r[i] = un[i];
+    }
+}
+
+/*
+ * Gives code outside of static_uint (mixed-width operators, companion
+ * types) access to the limbs without going through iterators
+ */
+struct limb_access {
+    template <typename uint>
+    static constexpr auto& get(uint& u) noexcept {
+        return u.data;
+    }
+};
 }  // namespace detail
 
+template <std::size_t size, typename limb, bool writable>
+struct static_uint_view;
+
 /**
  * static_uint: an unsigned integer parameterized by its bit size
  * Designed to be usable in arithmetic operations with normal unsigned
  * semantics
+ * The limb type is the unsigned integer the value is stored and
+ * computed in: narrower limbs get native double-width products on
+ * more targets, wider ones mean fewer limbs to walk through
  */
-template <std::size_t size>
+template <std::size_t size, typename limb_t = std::uint64_t>
 struct static_uint {
   private:
     static constexpr auto ARR_SIZE =
-        detail::required_array_size(size);
+        detail::required_array_size(size, sizeof(limb_t));
+
+    static_assert(size > 0, "static_uint needs at least one bit");
+    static_assert(static_cast<limb_t>(~limb_t{0}) > limb_t{0} &&
+                      sizeof(limb_t) >= sizeof(unsigned int),
+                  "Limbs must be unsigned integers at least as wide "
+                  "as unsigned int");
+
+    // the top limb is only partially used when size isn't a multiple
+    // of the limb size, and its unused bits are always kept at zero
+    std::array<limb_t, ARR_SIZE> data;
 
-    static_assert(
-        size % sizeof(std::size_t) == 0,
-        "Currently, only multiples of platform size are supported");
+    constexpr void mask_top_limb() noexcept {
+        detail::mask_top_limb<size>(data);
+    }
+
+    template <typename T>
+    using fits_in_limb_t =
+        std::enable_if_t<detail::fits_in_limb_v<T, limb_t>>;
+    // only unsigned __int128, where the compiler has it
+    template <typename T>
+    using u128_t = std::enable_if_t<
+        std::is_same_v<T, detail::native_uint_t<16>>>;
+
+    /*
+     * When the limbs add up to a native integer (static_uint<64> with
+     * 32-bit limbs, static_uint<128> with 64-bit limbs), operations
+     * that would otherwise loop and branch over limbs go through that
+     * type instead, which compiles to the same code as built-in
+     * arithmetic
+     * The storage is unchanged, so this is invisible from outside
+     */
+    using native_type = detail::native_uint_t<sizeof(data)>;
+    static constexpr bool USE_NATIVE =
+        ARR_SIZE > 1 && !std::is_void_v<native_type>;
+
+    // the lowest limbs of the value, as many as native holds
+    template <typename native = native_type>
+    constexpr native to_native() const noexcept {
+        constexpr auto limb_bits = sizeof(limb_t) * CHAR_BIT;
+        constexpr auto per_native =
+            (sizeof(native) + sizeof(limb_t) - 1) / sizeof(limb_t);
+        constexpr auto count =
+            per_native < ARR_SIZE ? per_native : ARR_SIZE;
+        if constexpr (count == 1) {
+            return static_cast<native>(data[0]);
+        } else {
+            auto result = native{0};
+            for (std::size_t i = count; i != 0; --i) {
+                result = (result << limb_bits) | data[i - 1];
+            }
+            return result;
+        }
+    }
+    template <typename native>
+    constexpr void from_native(native value) noexcept {
+        constexpr auto limb_bits = sizeof(limb_t) * CHAR_BIT;
+        for (std::size_t i = 0; i < ARR_SIZE; ++i) {
+            data[i] = static_cast<limb_t>(value >> (i * limb_bits));
+        }
+        mask_top_limb();
+    }
 
-    std::array<std::size_t, ARR_SIZE> data;
+    // first limb of a half, in the limb order widen_array uses
+    static constexpr std::size_t half_offset(bool high) noexcept {
+        static_assert(size % (2 * sizeof(limb_t) * CHAR_BIT) == 0,
+                      "Halves of a static_uint must be whole limbs");
+#if BOOST_ENDIAN_BIG_BYTE
+        return high ? 0 : ARR_SIZE / 2;
+#elif BOOST_ENDIAN_LITTLE_BYTE
+        return high ? ARR_SIZE / 2 : 0;
+#endif
+    }
 
   public:
+    using limb_type = limb_t;
+
     /**
      * Constructors for default/value initialisation and
      * initialisation from platform-sized integers
      */
     constexpr static_uint() noexcept = default;
     constexpr static_uint(std::size_t in) noexcept
-        : data{detail::widen_array<ARR_SIZE>(std::array{in})} {}
+        : data{detail::scalar_to_limbs<ARR_SIZE, limb_t>(in)} {
+        mask_top_limb();
+    }
+    template <typename T, typename = u128_t<T>>
+    constexpr static_uint(T in) noexcept
+        : data{detail::scalar_to_limbs<ARR_SIZE, limb_t>(in)} {
+        mask_top_limb();
+    }
+
+    /**
+     * Initialisation from limbs: an array in the same order as the
+     * limbs of a static_uint (like the widening constructor), or
+     * 'count' limbs from the least significant one
+     * Limbs past the size are dropped
+     */
+    template <std::size_t count>
+    constexpr explicit static_uint(
+        std::array<limb_t, count> const& in) noexcept
+        : data(detail::widen_array<ARR_SIZE>(in)) {
+        static_assert(count <= ARR_SIZE,
+                      "Too many limbs for this static_uint");
+        mask_top_limb();
+    }
+    static constexpr static_uint from_limbs(
+        limb_t const* limbs, std::size_t count) noexcept {
+        auto result = static_uint{};
+        for (std::size_t i = 0; i < count && i < ARR_SIZE; ++i) {
+            result.data[i] = limbs[i];
+        }
+        result.mask_top_limb();
+        return result;
+    }
 
     /**
      * Conversion from narrower static_uints
      * This is safe and cannot lead to truncation
      */
-    template <std::size_t other_size>
+    template <std::size_t other_size, typename other_limb_t>
     friend struct static_uint;
+    friend struct detail::limb_access;
     template <std::size_t other_size>
-    constexpr static_uint(static_uint<other_size> in) noexcept
+    constexpr static_uint(static_uint<other_size, limb_t> in) noexcept
         : data(detail::widen_array<ARR_SIZE>(in.data)) {
         static_assert(other_size <= size,
                       "Cannot convert a static_uint to a "
                       "smaller-size static_uint");
     }
 
+    /**
+     * The lowest 64 (or 128) bits as a built-in integer, truncating
+     * like a conversion between built-in unsigned types
+     * These only read the limbs that fit, and compile to moves
+     */
+    constexpr explicit operator std::uint64_t() const noexcept {
+        return to_native<std::uint64_t>();
+    }
+    template <typename native = detail::native_uint_t<16>,
+              typename = std::enable_if_t<!std::is_void_v<native>>>
+    constexpr native to_u128() const noexcept {
+        return to_native<native>();
+    }
+    template <typename T, typename = u128_t<T>>
+    constexpr explicit operator T() const noexcept {
+        return to_native<T>();
+    }
+
     /**
      * Iterators simply walk the underlying data from largest to
-     * smallest platform-sized uint
+     * smallest limb
      * This might be removed from public API in the future
      */
     using iterator =
@@ -191,135 +899,1573 @@ struct static_uint {
 
     // comparisons
     friend constexpr int compare(
-        static_uint<size> const& lhs,
-        static_uint<size> const& rhs) noexcept {
-        for (std::size_t i = static_uint<size>::ARR_SIZE; i != 0;
-             --i) {
-            if (lhs.data[i - 1] > rhs.data[i - 1]) {
-                return 1;
-            }
-            if (lhs.data[i - 1] < rhs.data[i - 1]) {
-                return -1;
-            }
+        static_uint const& lhs,
+        static_uint const& rhs) noexcept {
+        if constexpr (USE_NATIVE) {
+            auto const l = lhs.to_native();
+            auto const r = rhs.to_native();
+            return (l > r) - (l < r);
         }
-        return 0;
+        return detail::compare_limbs(lhs.data.data(), ARR_SIZE,
+                                     rhs.data.data(), ARR_SIZE);
     }
 
     friend constexpr bool operator==(
-        static_uint<size> const& lhs,
-        static_uint<size> const& rhs) noexcept {
+        static_uint const& lhs,
+        static_uint const& rhs) noexcept {
         return compare(lhs, rhs) == 0;
     }
     friend constexpr bool operator>(
-        static_uint<size> const& lhs,
-        static_uint<size> const& rhs) noexcept {
+        static_uint const& lhs,
+        static_uint const& rhs) noexcept {
         return compare(lhs, rhs) > 0;
     }
     friend constexpr bool operator<(
-        static_uint<size> const& lhs,
-        static_uint<size> const& rhs) noexcept {
+        static_uint const& lhs,
+        static_uint const& rhs) noexcept {
         return compare(lhs, rhs) < 0;
     }
     friend constexpr bool operator>=(
-        static_uint<size> const& lhs,
-        static_uint<size> const& rhs) noexcept {
+        static_uint const& lhs,
+        static_uint const& rhs) noexcept {
         return compare(lhs, rhs) >= 0;
     }
     friend constexpr bool operator<=(
-        static_uint<size> const& lhs,
-        static_uint<size> const& rhs) noexcept {
+        static_uint const& lhs,
+        static_uint const& rhs) noexcept {
         return compare(lhs, rhs) <= 0;
     }
     friend constexpr bool operator!=(
-        static_uint<size> const& lhs,
-        static_uint<size> const& rhs) noexcept {
+        static_uint const& lhs,
+        static_uint const& rhs) noexcept {
         return compare(lhs, rhs) != 0;
     }
 
-    // arithmetic
-    constexpr static_uint& operator+=(
-        static_uint const& other) noexcept {
-        bool overflow = false;
-        for (std::size_t i = 0; i < static_uint<size>::ARR_SIZE;
-             ++i) {
-            data[i] += other.data[i] + (overflow ? 1 : 0);
-            overflow = data[i] < other.data[i];
-        }
-        return *this;
-    }
-    friend constexpr static_uint<size> operator+(
-        static_uint<size> const& lhs,
-        static_uint<size> const& rhs) noexcept {
-        auto result = lhs;
-        return result += rhs;
+    /**
+     * Comparisons with built-in integers only look at the lowest limb
+     * and check the others for zero
+     */
+    template <typename T, typename = fits_in_limb_t<T>>
+    friend constexpr int compare(static_uint const& lhs,
+                                 T rhs) noexcept {
+        auto const low = static_cast<limb_t>(rhs);
+        return detail::compare_limbs(lhs.data.data(), ARR_SIZE, &low,
+                                     1);
     }
 
-    // bitwise operations
-    constexpr static_uint& operator&=(
-        static_uint const& rhs) noexcept {
-        for (std::size_t i = 0; i < static_uint::ARR_SIZE; ++i) {
-            data[i] &= rhs.data[i];
-        }
-        return *this;
+    template <typename T, typename = fits_in_limb_t<T>>
+    friend constexpr bool operator==(static_uint const& lhs,
+                                     T rhs) noexcept {
+        return compare(lhs, rhs) == 0;
     }
-    friend constexpr static_uint<size> operator&(
-        static_uint const& lhs, static_uint const& rhs) noexcept {
-        auto result = lhs;
-        result &= rhs;
-        return result;
+    template <typename T, typename = fits_in_limb_t<T>>
+    friend constexpr bool operator>(static_uint const& lhs,
+                                    T rhs) noexcept {
+        return compare(lhs, rhs) > 0;
     }
-
-    constexpr static_uint& operator>>=(unsigned int shift) noexcept {
-        // each time, bottom 'shift' bits become the top bits of the
-        // lower level
-
-        constexpr auto elem_bits = sizeof(std::size_t) * CHAR_BIT;
-
-        // for every full elem shift, just move full elements right
-        if (auto const right_elem_shift = shift / elem_bits) {
-            constd::copy(rbegin() + right_elem_shift, rend(),
-                         rbegin());
-            constd::fill(begin(), begin() + right_elem_shift, 0);
-        }
-
-        // perform the smaller bitwise shift, if any
-        auto const bitshift = shift % elem_bits;
-        if (bitshift) {
-            constd::accumulate(
-                begin(), end(), std::size_t{0},
-                [bitshift](std::size_t carry, auto& elem) {
-                    auto const next_carry = elem
-                                            << (elem_bits - bitshift);
-                    elem >>= bitshift;
-                    elem |= carry;
-                    return next_carry;
-                });
-        }
-        return *this;
+    template <typename T, typename = fits_in_limb_t<T>>
+    friend constexpr bool operator<(static_uint const& lhs,
+                                    T rhs) noexcept {
+        return compare(lhs, rhs) < 0;
     }
-
-    friend constexpr static_uint<size> operator>>(
-        static_uint const& lhs, unsigned int shift) noexcept {
-        auto result = lhs;
-        result >>= shift;
-        return result;
+    template <typename T, typename = fits_in_limb_t<T>>
+    friend constexpr bool operator>=(static_uint const& lhs,
+                                     T rhs) noexcept {
+        return compare(lhs, rhs) >= 0;
+    }
+    template <typename T, typename = fits_in_limb_t<T>>
+    friend constexpr bool operator<=(static_uint const& lhs,
+                                     T rhs) noexcept {
+        return compare(lhs, rhs) <= 0;
+    }
+    template <typename T, typename = fits_in_limb_t<T>>
+    friend constexpr bool operator!=(static_uint const& lhs,
+                                     T rhs) noexcept {
+        return compare(lhs, rhs) != 0;
     }
-};
 
-namespace std {
-// NOTE(quentin): this is not a full specialisation, which
-// isn't ideal
-template <std::size_t size>
-struct numeric_limits<static_uint<size>> {
-    static constexpr bool is_specialized() noexcept { return true; }
+    template <typename T, typename = fits_in_limb_t<T>>
+    friend constexpr bool operator==(
+        T lhs, static_uint const& rhs) noexcept {
+        return compare(rhs, lhs) == 0;
+    }
+    template <typename T, typename = fits_in_limb_t<T>>
+    friend constexpr bool operator>(
+        T lhs, static_uint const& rhs) noexcept {
+        return compare(rhs, lhs) < 0;
+    }
+    template <typename T, typename = fits_in_limb_t<T>>
+    friend constexpr bool operator<(
+        T lhs, static_uint const& rhs) noexcept {
+        return compare(rhs, lhs) > 0;
+    }
+    template <typename T, typename = fits_in_limb_t<T>>
+    friend constexpr bool operator>=(
+        T lhs, static_uint const& rhs) noexcept {
+        return compare(rhs, lhs) <= 0;
+    }
+    template <typename T, typename = fits_in_limb_t<T>>
+    friend constexpr bool operator<=(
+        T lhs, static_uint const& rhs) noexcept {
+        return compare(rhs, lhs) >= 0;
+    }
+    template <typename T, typename = fits_in_limb_t<T>>
+    friend constexpr bool operator!=(
+        T lhs, static_uint const& rhs) noexcept {
+        return compare(rhs, lhs) != 0;
+    }
+
+    /**
+     * Destination-passing forms of the binary operators, which the
+     * operators themselves are written with
+     * dst is written in a single pass over the operands' limbs,
+     * without copying either of them first, and may be one of them
+     */
+    friend constexpr void add_into(static_uint& dst,
+                                  static_uint const& lhs,
+                                  static_uint const& rhs) noexcept {
+        if constexpr (USE_NATIVE) {
+            dst.from_native(lhs.to_native() + rhs.to_native());
+            return;
+        }
+        detail::add_limbs_to(dst.data.data(), lhs.data.data(),
+                             rhs.data.data(), ARR_SIZE);
+        dst.mask_top_limb();
+    }
+    friend constexpr void sub_into(static_uint& dst,
+                                  static_uint const& lhs,
+                                  static_uint const& rhs) noexcept {
+        if constexpr (USE_NATIVE) {
+            dst.from_native(lhs.to_native() - rhs.to_native());
+            return;
+        }
+        detail::sub_limbs_to(dst.data.data(), lhs.data.data(),
+                             rhs.data.data(), ARR_SIZE);
+        dst.mask_top_limb();
+    }
+    friend constexpr void mul_into(static_uint& dst,
+                                  static_uint const& lhs,
+                                  static_uint const& rhs) noexcept {
+        if constexpr (USE_NATIVE) {
+            dst.from_native(lhs.to_native() * rhs.to_native());
+            return;
+        }
+        if (&dst == &lhs || &dst == &rhs) {
+            // the kernel reads the operands while writing dst
+            auto result = static_uint{};
+            mul_into(result, lhs, rhs);
+            dst = result;
+            return;
+        }
+        detail::mul_limbs(dst.data.data(), ARR_SIZE, lhs.data.data(),
+                          ARR_SIZE, rhs.data.data(), ARR_SIZE);
+        dst.mask_top_limb();
+    }
+    friend constexpr void and_into(static_uint& dst,
+                                  static_uint const& lhs,
+                                  static_uint const& rhs) noexcept {
+        for (std::size_t i = 0; i < ARR_SIZE; ++i) {
+            dst.data[i] = lhs.data[i] & rhs.data[i];
+        }
+    }
+    friend constexpr void shr_into(static_uint& dst,
+                                  static_uint const& src,
+                                  unsigned int shift) noexcept {
+        if (shift >= size) {
+            dst = static_uint{};
+            return;
+        }
+        if constexpr (USE_NATIVE) {
+            dst.from_native(src.to_native() >> shift);
+            return;
+        }
+        detail::shr_limbs(dst.data.data(), src.data.data(), ARR_SIZE,
+                          shift);
+    }
+
+    /**
+     * Views of the most and least significant halves of the value,
+     * aliasing its limbs in place (see static_uint_view)
+     * Both halves must be made of whole limbs
+     */
+    constexpr static_uint_view<size / 2, limb_t, true> hi() noexcept {
+        return static_uint_view<size / 2, limb_t, true>{
+            data.data() + half_offset(true)};
+    }
+    constexpr static_uint_view<size / 2, limb_t, false> hi()
+        const noexcept {
+        return static_uint_view<size / 2, limb_t, false>{
+            data.data() + half_offset(true)};
+    }
+    constexpr static_uint_view<size / 2, limb_t, true> lo() noexcept {
+        return static_uint_view<size / 2, limb_t, true>{
+            data.data() + half_offset(false)};
+    }
+    constexpr static_uint_view<size / 2, limb_t, false> lo()
+        const noexcept {
+        return static_uint_view<size / 2, limb_t, false>{
+            data.data() + half_offset(false)};
+    }
+
+    // arithmetic
+    constexpr static_uint& operator+=(
+        static_uint const& other) noexcept {
+        add_into(*this, *this, other);
+        return *this;
+    }
+    friend constexpr static_uint operator+(
+        static_uint const& lhs,
+        static_uint const& rhs) noexcept {
+        auto result = static_uint{};
+        add_into(result, lhs, rhs);
+        return result;
+    }
+
+    constexpr static_uint& operator-=(
+        static_uint const& other) noexcept {
+        sub_into(*this, *this, other);
+        return *this;
+    }
+    friend constexpr static_uint operator-(
+        static_uint const& lhs,
+        static_uint const& rhs) noexcept {
+        auto result = static_uint{};
+        sub_into(result, lhs, rhs);
+        return result;
+    }
+
+    constexpr static_uint& operator*=(
+        static_uint const& other) noexcept {
+        mul_into(*this, *this, other);
+        return *this;
+    }
+    friend constexpr static_uint operator*(
+        static_uint const& lhs,
+        static_uint const& rhs) noexcept {
+        auto result = static_uint{};
+        mul_into(result, lhs, rhs);
+        return result;
+    }
+
+    /**
+     * Arithmetic with built-in integers works on the lowest limb and
+     * only carries into the others when needed
+     */
+    template <typename T, typename = fits_in_limb_t<T>>
+    constexpr static_uint& operator+=(T other) noexcept {
+        auto const low = static_cast<limb_t>(other);
+        detail::add_limbs(data.data(), ARR_SIZE, &low, 1);
+        mask_top_limb();
+        return *this;
+    }
+    template <typename T, typename = fits_in_limb_t<T>>
+    friend constexpr static_uint operator+(
+        static_uint const& lhs, T rhs) noexcept {
+        auto result = lhs;
+        return result += rhs;
+    }
+    template <typename T, typename = fits_in_limb_t<T>>
+    friend constexpr static_uint operator+(
+        T lhs, static_uint const& rhs) noexcept {
+        auto result = rhs;
+        return result += lhs;
+    }
+
+    template <typename T, typename = fits_in_limb_t<T>>
+    constexpr static_uint& operator-=(T other) noexcept {
+        auto const low = static_cast<limb_t>(other);
+        detail::sub_limbs(data.data(), ARR_SIZE, &low, 1);
+        mask_top_limb();
+        return *this;
+    }
+    template <typename T, typename = fits_in_limb_t<T>>
+    friend constexpr static_uint operator-(
+        static_uint const& lhs, T rhs) noexcept {
+        auto result = lhs;
+        return result -= rhs;
+    }
+
+    template <typename T, typename = fits_in_limb_t<T>>
+    constexpr static_uint& operator*=(T other) noexcept {
+        detail::mul_limb(data.data(), ARR_SIZE,
+                         static_cast<limb_t>(other));
+        mask_top_limb();
+        return *this;
+    }
+    template <typename T, typename = fits_in_limb_t<T>>
+    friend constexpr static_uint operator*(
+        static_uint const& lhs, T rhs) noexcept {
+        auto result = lhs;
+        return result *= rhs;
+    }
+    template <typename T, typename = fits_in_limb_t<T>>
+    friend constexpr static_uint operator*(
+        T lhs, static_uint const& rhs) noexcept {
+        auto result = rhs;
+        return result *= lhs;
+    }
+
+    /**
+     * Division, truncating like for built-in unsigned integers
+     * Dividing by zero is undefined, and asserts in debug builds
+     * See also divmod, which gives both results of a single division
+     */
+    constexpr static_uint& operator/=(
+        static_uint const& other) noexcept {
+        return *this = *this / other;
+    }
+    friend constexpr static_uint operator/(
+        static_uint const& lhs,
+        static_uint const& rhs) noexcept {
+        if constexpr (USE_NATIVE) {
+            assert(rhs != 0 && "division by zero");
+            auto result = static_uint{};
+            result.from_native(lhs.to_native() / rhs.to_native());
+            return result;
+        }
+        return divmod(lhs, rhs).quotient;
+    }
+
+    constexpr static_uint& operator%=(
+        static_uint const& other) noexcept {
+        return *this = *this % other;
+    }
+    friend constexpr static_uint operator%(
+        static_uint const& lhs,
+        static_uint const& rhs) noexcept {
+        if constexpr (USE_NATIVE) {
+            assert(rhs != 0 && "division by zero");
+            auto result = static_uint{};
+            result.from_native(lhs.to_native() % rhs.to_native());
+            return result;
+        }
+        return divmod(lhs, rhs).remainder;
+    }
+
+    // a single limb divisor only needs one pass over the dividend
+    template <typename T, typename = fits_in_limb_t<T>>
+    constexpr static_uint& operator/=(T other) noexcept {
+        assert(other != 0 && "division by zero");
+        detail::div_limb(data.data(), data.data(), ARR_SIZE,
+                         static_cast<limb_t>(other));
+        return *this;
+    }
+    template <typename T, typename = fits_in_limb_t<T>>
+    friend constexpr static_uint operator/(
+        static_uint const& lhs, T rhs) noexcept {
+        auto result = lhs;
+        return result /= rhs;
+    }
+
+    template <typename T, typename = fits_in_limb_t<T>>
+    constexpr static_uint& operator%=(T other) noexcept {
+        assert(other != 0 && "division by zero");
+        auto quotient = data;
+        auto const rem =
+            detail::div_limb(quotient.data(), data.data(), ARR_SIZE,
+                             static_cast<limb_t>(other));
+        *this = static_uint{};
+        data[0] = rem;
+        return *this;
+    }
+    template <typename T, typename = fits_in_limb_t<T>>
+    friend constexpr static_uint operator%(
+        static_uint const& lhs, T rhs) noexcept {
+        auto result = lhs;
+        return result %= rhs;
+    }
+
+    /**
+     * Increment and decrement
+     * Carry/borrow propagation stops at the first limb that doesn't
+     * wrap, which is nearly always the lowest one
+     */
+    constexpr static_uint& operator++() noexcept {
+        for (std::size_t i = 0; i < static_uint::ARR_SIZE; ++i) {
+            if (++data[i] != 0) {
+                break;
+            }
+        }
+        mask_top_limb();
+        return *this;
+    }
+    constexpr static_uint operator++(int) noexcept {
+        auto result = *this;
+        ++*this;
+        return result;
+    }
+    constexpr static_uint& operator--() noexcept {
+        for (std::size_t i = 0; i < static_uint::ARR_SIZE; ++i) {
+            if (data[i]-- != 0) {
+                break;
+            }
+        }
+        mask_top_limb();
+        return *this;
+    }
+    constexpr static_uint operator--(int) noexcept {
+        auto result = *this;
+        --*this;
+        return result;
+    }
+
+    // bitwise operations
+    constexpr static_uint& operator&=(
+        static_uint const& rhs) noexcept {
+        and_into(*this, *this, rhs);
+        return *this;
+    }
+    friend constexpr static_uint operator&(
+        static_uint const& lhs, static_uint const& rhs) noexcept {
+        auto result = static_uint{};
+        and_into(result, lhs, rhs);
+        return result;
+    }
+
+    template <typename T, typename = fits_in_limb_t<T>>
+    constexpr static_uint& operator&=(T rhs) noexcept {
+        auto const low = data[0] & static_cast<limb_t>(rhs);
+        *this = static_uint{};
+        data[0] = low;
+        return *this;
+    }
+    template <typename T, typename = fits_in_limb_t<T>>
+    friend constexpr static_uint operator&(
+        static_uint const& lhs, T rhs) noexcept {
+        auto result = static_uint{};
+        result.data[0] = lhs.data[0] & static_cast<limb_t>(rhs);
+        return result;
+    }
+    template <typename T, typename = fits_in_limb_t<T>>
+    friend constexpr static_uint operator&(
+        T lhs, static_uint const& rhs) noexcept {
+        return rhs & lhs;
+    }
+
+    constexpr static_uint& operator|=(
+        static_uint const& rhs) noexcept {
+        for (std::size_t i = 0; i < static_uint::ARR_SIZE; ++i) {
+            data[i] |= rhs.data[i];
+        }
+        return *this;
+    }
+    friend constexpr static_uint operator|(
+        static_uint const& lhs, static_uint const& rhs) noexcept {
+        auto result = lhs;
+        result |= rhs;
+        return result;
+    }
+
+    template <typename T, typename = fits_in_limb_t<T>>
+    constexpr static_uint& operator|=(T rhs) noexcept {
+        data[0] |= static_cast<limb_t>(rhs);
+        mask_top_limb();
+        return *this;
+    }
+    template <typename T, typename = fits_in_limb_t<T>>
+    friend constexpr static_uint operator|(
+        static_uint const& lhs, T rhs) noexcept {
+        auto result = lhs;
+        return result |= rhs;
+    }
+    template <typename T, typename = fits_in_limb_t<T>>
+    friend constexpr static_uint operator|(
+        T lhs, static_uint const& rhs) noexcept {
+        return rhs | lhs;
+    }
+
+    constexpr static_uint& operator^=(
+        static_uint const& rhs) noexcept {
+        for (std::size_t i = 0; i < static_uint::ARR_SIZE; ++i) {
+            data[i] ^= rhs.data[i];
+        }
+        return *this;
+    }
+    friend constexpr static_uint operator^(
+        static_uint const& lhs, static_uint const& rhs) noexcept {
+        auto result = lhs;
+        result ^= rhs;
+        return result;
+    }
+
+    template <typename T, typename = fits_in_limb_t<T>>
+    constexpr static_uint& operator^=(T rhs) noexcept {
+        data[0] ^= static_cast<limb_t>(rhs);
+        mask_top_limb();
+        return *this;
+    }
+    template <typename T, typename = fits_in_limb_t<T>>
+    friend constexpr static_uint operator^(
+        static_uint const& lhs, T rhs) noexcept {
+        auto result = lhs;
+        return result ^= rhs;
+    }
+    template <typename T, typename = fits_in_limb_t<T>>
+    friend constexpr static_uint operator^(
+        T lhs, static_uint const& rhs) noexcept {
+        return rhs ^ lhs;
+    }
+
+    friend constexpr static_uint operator~(
+        static_uint const& value) noexcept {
+        auto result = value;
+        for (auto& limb : result.data) {
+            limb = static_cast<limb_t>(~limb);
+        }
+        result.mask_top_limb();
+        return result;
+    }
+
+    constexpr static_uint& operator<<=(unsigned int shift) noexcept {
+        if (shift >= size) {
+            return *this = static_uint{};
+        }
+        if constexpr (USE_NATIVE) {
+            from_native(to_native() << shift);
+            return *this;
+        }
+        detail::shl_limbs(data.data(), ARR_SIZE, shift);
+        mask_top_limb();
+        return *this;
+    }
+    friend constexpr static_uint operator<<(
+        static_uint const& lhs, unsigned int shift) noexcept {
+        auto result = lhs;
+        result <<= shift;
+        return result;
+    }
+
+    constexpr static_uint& operator>>=(unsigned int shift) noexcept {
+        shr_into(*this, *this, shift);
+        return *this;
+    }
+
+    friend constexpr static_uint operator>>(
+        static_uint const& lhs, unsigned int shift) noexcept {
+        auto result = static_uint{};
+        shr_into(result, lhs, shift);
+        return result;
+    }
+};
+
+/**
+ * Result type of operations mixing static_uints of different sizes
+ * Like for built-in types, the narrower operand is promoted to the
+ * wider one's size
+ */
+template <std::size_t lhs_size, std::size_t rhs_size,
+          typename limb = std::uint64_t>
+struct common_static_uint {
+    static constexpr auto size = lhs_size > rhs_size ? lhs_size
+                                                     : rhs_size;
+    using type = static_uint<size, limb>;
+};
+template <std::size_t lhs_size, std::size_t rhs_size,
+          typename limb = std::uint64_t>
+using common_static_uint_t =
+    typename common_static_uint<lhs_size, rhs_size, limb>::type;
+
+/**
+ * Mixed-width operators
+ * These work directly on each operand's limbs, so the narrower one is
+ * never widened into a temporary
+ */
+template <std::size_t lhs_size, std::size_t rhs_size, typename limb,
+          typename = std::enable_if_t<lhs_size != rhs_size>>
+constexpr int compare(
+    static_uint<lhs_size, limb> const& lhs,
+    static_uint<rhs_size, limb> const& rhs) noexcept {
+    auto const& l = detail::limb_access::get(lhs);
+    auto const& r = detail::limb_access::get(rhs);
+    return detail::compare_limbs(l.data(), l.size(), r.data(),
+                                 r.size());
+}
+
+template <std::size_t lhs_size, std::size_t rhs_size, typename limb,
+          typename = std::enable_if_t<lhs_size != rhs_size>>
+constexpr bool operator==(
+    static_uint<lhs_size, limb> const& lhs,
+    static_uint<rhs_size, limb> const& rhs) noexcept {
+    return compare(lhs, rhs) == 0;
+}
+template <std::size_t lhs_size, std::size_t rhs_size, typename limb,
+          typename = std::enable_if_t<lhs_size != rhs_size>>
+constexpr bool operator>(
+    static_uint<lhs_size, limb> const& lhs,
+    static_uint<rhs_size, limb> const& rhs) noexcept {
+    return compare(lhs, rhs) > 0;
+}
+template <std::size_t lhs_size, std::size_t rhs_size, typename limb,
+          typename = std::enable_if_t<lhs_size != rhs_size>>
+constexpr bool operator<(
+    static_uint<lhs_size, limb> const& lhs,
+    static_uint<rhs_size, limb> const& rhs) noexcept {
+    return compare(lhs, rhs) < 0;
+}
+template <std::size_t lhs_size, std::size_t rhs_size, typename limb,
+          typename = std::enable_if_t<lhs_size != rhs_size>>
+constexpr bool operator>=(
+    static_uint<lhs_size, limb> const& lhs,
+    static_uint<rhs_size, limb> const& rhs) noexcept {
+    return compare(lhs, rhs) >= 0;
+}
+template <std::size_t lhs_size, std::size_t rhs_size, typename limb,
+          typename = std::enable_if_t<lhs_size != rhs_size>>
+constexpr bool operator<=(
+    static_uint<lhs_size, limb> const& lhs,
+    static_uint<rhs_size, limb> const& rhs) noexcept {
+    return compare(lhs, rhs) <= 0;
+}
+template <std::size_t lhs_size, std::size_t rhs_size, typename limb,
+          typename = std::enable_if_t<lhs_size != rhs_size>>
+constexpr bool operator!=(
+    static_uint<lhs_size, limb> const& lhs,
+    static_uint<rhs_size, limb> const& rhs) noexcept {
+    return compare(lhs, rhs) != 0;
+}
+
+template <std::size_t lhs_size, std::size_t rhs_size, typename limb,
+          typename = std::enable_if_t<lhs_size != rhs_size>>
+constexpr common_static_uint_t<lhs_size, rhs_size, limb> operator+(
+    static_uint<lhs_size, limb> const& lhs,
+    static_uint<rhs_size, limb> const& rhs) noexcept {
+    if constexpr (lhs_size > rhs_size) {
+        auto result = lhs;
+        auto& dst = detail::limb_access::get(result);
+        auto const& src = detail::limb_access::get(rhs);
+        detail::add_limbs(dst.data(), dst.size(), src.data(),
+                          src.size());
+        detail::mask_top_limb<lhs_size>(dst);
+        return result;
+    } else {
+        return rhs + lhs;
+    }
+}
+
+template <std::size_t lhs_size, std::size_t rhs_size, typename limb,
+          typename = std::enable_if_t<lhs_size != rhs_size>>
+constexpr common_static_uint_t<lhs_size, rhs_size, limb> operator-(
+    static_uint<lhs_size, limb> const& lhs,
+    static_uint<rhs_size, limb> const& rhs) noexcept {
+    auto result = common_static_uint_t<lhs_size, rhs_size, limb>{lhs};
+    auto& dst = detail::limb_access::get(result);
+    auto const& src = detail::limb_access::get(rhs);
+    detail::sub_limbs(dst.data(), dst.size(), src.data(), src.size());
+    detail::mask_top_limb<
+        common_static_uint<lhs_size, rhs_size, limb>::size>(dst);
+    return result;
+}
+
+template <std::size_t lhs_size, std::size_t rhs_size, typename limb,
+          typename = std::enable_if_t<lhs_size != rhs_size>>
+constexpr common_static_uint_t<lhs_size, rhs_size, limb> operator*(
+    static_uint<lhs_size, limb> const& lhs,
+    static_uint<rhs_size, limb> const& rhs) noexcept {
+    auto result = common_static_uint_t<lhs_size, rhs_size, limb>{};
+    auto& dst = detail::limb_access::get(result);
+    auto const& l = detail::limb_access::get(lhs);
+    auto const& r = detail::limb_access::get(rhs);
+    detail::mul_limbs(dst.data(), dst.size(), l.data(), l.size(),
+                      r.data(), r.size());
+    detail::mask_top_limb<
+        common_static_uint<lhs_size, rhs_size, limb>::size>(dst);
+    return result;
+}
+
+template <std::size_t lhs_size, std::size_t rhs_size, typename limb,
+          typename = std::enable_if_t<lhs_size != rhs_size>>
+constexpr common_static_uint_t<lhs_size, rhs_size, limb> operator&(
+    static_uint<lhs_size, limb> const& lhs,
+    static_uint<rhs_size, limb> const& rhs) noexcept {
+    auto result = common_static_uint_t<lhs_size, rhs_size, limb>{};
+    auto& dst = detail::limb_access::get(result);
+    auto const& l = detail::limb_access::get(lhs);
+    auto const& r = detail::limb_access::get(rhs);
+    for (std::size_t i = 0; i < l.size() && i < r.size(); ++i) {
+        dst[i] = l[i] & r[i];
+    }
+    return result;
+}
+
+namespace std {
+template <std::size_t lhs_size, std::size_t rhs_size, typename limb>
+struct common_type<static_uint<lhs_size, limb>,
+                   static_uint<rhs_size, limb>>
+    : ::common_static_uint<lhs_size, rhs_size, limb> {};
+
+// NOTE(quentin): this is not a full specialisation, which
+// isn't ideal
+template <std::size_t size, typename limb>
+struct numeric_limits<static_uint<size, limb>> {
+    static constexpr bool is_specialized() noexcept { return true; }
     static constexpr bool is_integer() noexcept { return true; }
     static constexpr bool is_exact() noexcept { return true; }
     static constexpr bool is_signed() noexcept { return false; }
-    static constexpr static_uint<size> max() noexcept {
-        auto result = static_uint<size>{};
+    static constexpr static_uint<size, limb> max() noexcept {
+        auto result = static_uint<size, limb>{};
         ::constd::fill(result.begin(), result.end(),
-                       std::numeric_limits<std::size_t>::max());
+                       static_cast<limb>(~limb{0}));
+        *result.begin() &= ::detail::top_limb_mask<limb>(size);
         return result;
     }
 };
 }  // namespace std
+
+/**
+ * Overflow-aware arithmetic
+ * The carry, borrow or overflow falls out of the limb kernels, so
+ * detecting it costs no extra pass over the result
+ */
+template <typename uint>
+struct add_result {
+    uint sum;
+    bool carry_out;
+};
+template <typename uint>
+struct sub_result {
+    uint difference;
+    bool borrow_out;
+};
+
+template <std::size_t size, typename limb>
+constexpr add_result<static_uint<size, limb>> add_with_carry(
+    static_uint<size, limb> const& lhs,
+    static_uint<size, limb> const& rhs,
+    bool carry_in = false) noexcept {
+    auto result = add_result<static_uint<size, limb>>{lhs, false};
+    auto& dst = detail::limb_access::get(result.sum);
+    auto const& src = detail::limb_access::get(rhs);
+    result.carry_out = detail::add_limbs(dst.data(), dst.size(),
+                                         src.data(), src.size(),
+                                         carry_in);
+    // with a partial top limb, the carry lands in its unused bits
+    if constexpr (detail::top_limb_mask<limb>(size) !=
+                  static_cast<limb>(~limb{0})) {
+        result.carry_out =
+            (dst.back() & ~detail::top_limb_mask<limb>(size)) != 0;
+        detail::mask_top_limb<size>(dst);
+    }
+    return result;
+}
+
+template <std::size_t size, typename limb>
+constexpr sub_result<static_uint<size, limb>> sub_with_borrow(
+    static_uint<size, limb> const& lhs,
+    static_uint<size, limb> const& rhs,
+    bool borrow_in = false) noexcept {
+    auto result = sub_result<static_uint<size, limb>>{lhs, false};
+    auto& dst = detail::limb_access::get(result.difference);
+    auto const& src = detail::limb_access::get(rhs);
+    result.borrow_out = detail::sub_limbs(dst.data(), dst.size(),
+                                          src.data(), src.size(),
+                                          borrow_in);
+    detail::mask_top_limb<size>(dst);
+    return result;
+}
+
+/**
+ * Narrowing conversions, the explicit counterpart of the widening
+ * constructor: truncate keeps the lowest 'to' bits, checked_narrow is
+ * empty if any of the dropped bits is set
+ * Both copy the low limbs; checked_narrow ORs the others together
+ * rather than branching on each one
+ */
+template <std::size_t to, std::size_t from, typename limb>
+constexpr static_uint<to, limb> truncate(
+    static_uint<from, limb> const& value) noexcept {
+    auto result = static_uint<to, limb>{};
+    auto& dst = detail::limb_access::get(result);
+    auto const& src = detail::limb_access::get(value);
+    for (std::size_t i = 0; i < dst.size() && i < src.size(); ++i) {
+        dst[i] = src[i];
+    }
+    detail::mask_top_limb<to>(dst);
+    return result;
+}
+template <std::size_t to, std::size_t from, typename limb>
+constexpr std::optional<static_uint<to, limb>> checked_narrow(
+    static_uint<from, limb> const& value) noexcept {
+    auto const result = truncate<to>(value);
+    auto const& src = detail::limb_access::get(value);
+    auto const& dst = detail::limb_access::get(result);
+    // bits of the shared limbs that truncate cleared
+    auto dropped = limb{0};
+    for (std::size_t i = 0; i < dst.size() && i < src.size(); ++i) {
+        dropped |= src[i] ^ dst[i];
+    }
+    for (std::size_t i = dst.size(); i < src.size(); ++i) {
+        dropped |= src[i];
+    }
+    if (dropped != 0) {
+        return std::nullopt;
+    }
+    return result;
+}
+
+namespace detail {
+/*
+ * Truncated product, also returning whether it overflowed
+ */
+template <std::size_t size, typename limb>
+constexpr bool mul_overflow(
+    static_uint<size, limb> const& lhs,
+    static_uint<size, limb> const& rhs,
+    static_uint<size, limb>& result) noexcept {
+    auto& dst = limb_access::get(result);
+    auto const& l = limb_access::get(lhs);
+    auto const& r = limb_access::get(rhs);
+    auto overflow = mul_limbs<true>(dst.data(), dst.size(), l.data(),
+                                    l.size(), r.data(), r.size());
+    overflow =
+        overflow || (dst.back() & ~top_limb_mask<limb>(size)) != 0;
+    mask_top_limb<size>(dst);
+    return overflow;
+}
+}  // namespace detail
+
+/**
+ * Checked arithmetic: empty if the result doesn't fit
+ */
+template <std::size_t size, typename limb>
+constexpr std::optional<static_uint<size, limb>> checked_add(
+    static_uint<size, limb> const& lhs,
+    static_uint<size, limb> const& rhs) noexcept {
+    auto const [sum, carry_out] = add_with_carry(lhs, rhs);
+    if (carry_out) {
+        return std::nullopt;
+    }
+    return sum;
+}
+template <std::size_t size, typename limb>
+constexpr std::optional<static_uint<size, limb>> checked_sub(
+    static_uint<size, limb> const& lhs,
+    static_uint<size, limb> const& rhs) noexcept {
+    auto const [difference, borrow_out] = sub_with_borrow(lhs, rhs);
+    if (borrow_out) {
+        return std::nullopt;
+    }
+    return difference;
+}
+template <std::size_t size, typename limb>
+constexpr std::optional<static_uint<size, limb>> checked_mul(
+    static_uint<size, limb> const& lhs,
+    static_uint<size, limb> const& rhs) noexcept {
+    auto product = static_uint<size, limb>{};
+    if (detail::mul_overflow(lhs, rhs, product)) {
+        return std::nullopt;
+    }
+    return product;
+}
+
+/**
+ * Saturating arithmetic: clamps to 0 or the maximum value instead of
+ * wrapping around
+ */
+template <std::size_t size, typename limb>
+constexpr static_uint<size, limb> saturating_add(
+    static_uint<size, limb> const& lhs,
+    static_uint<size, limb> const& rhs) noexcept {
+    auto const [sum, carry_out] = add_with_carry(lhs, rhs);
+    return carry_out
+               ? std::numeric_limits<static_uint<size, limb>>::max()
+               : sum;
+}
+template <std::size_t size, typename limb>
+constexpr static_uint<size, limb> saturating_sub(
+    static_uint<size, limb> const& lhs,
+    static_uint<size, limb> const& rhs) noexcept {
+    auto const [difference, borrow_out] = sub_with_borrow(lhs, rhs);
+    return borrow_out ? static_uint<size, limb>{} : difference;
+}
+template <std::size_t size, typename limb>
+constexpr static_uint<size, limb> saturating_mul(
+    static_uint<size, limb> const& lhs,
+    static_uint<size, limb> const& rhs) noexcept {
+    auto product = static_uint<size, limb>{};
+    if (detail::mul_overflow(lhs, rhs, product)) {
+        return std::numeric_limits<static_uint<size, limb>>::max();
+    }
+    return product;
+}
+
+/**
+ * Widening and fused multiplications
+ * mul_wide returns the full double-width product; fma and mac_into
+ * accumulate the product directly on top of the addend instead of
+ * adding it in a separate pass
+ */
+template <std::size_t size, typename limb>
+constexpr static_uint<2 * size, limb> mul_wide(
+    static_uint<size, limb> const& lhs,
+    static_uint<size, limb> const& rhs) noexcept {
+    auto result = static_uint<2 * size, limb>{};
+    auto& dst = detail::limb_access::get(result);
+    auto const& l = detail::limb_access::get(lhs);
+    auto const& r = detail::limb_access::get(rhs);
+    detail::mul_limbs(dst.data(), dst.size(), l.data(), l.size(),
+                      r.data(), r.size());
+    return result;
+}
+
+template <std::size_t acc_size, std::size_t size,
+          typename limb>
+constexpr void mac_into(static_uint<acc_size, limb>& acc,
+                        static_uint<size, limb> const& lhs,
+                        static_uint<size, limb> const& rhs) noexcept {
+    auto& dst = detail::limb_access::get(acc);
+    auto const& l = detail::limb_access::get(lhs);
+    auto const& r = detail::limb_access::get(rhs);
+    if constexpr (acc_size == size) {
+        if (&acc == &lhs || &acc == &rhs) {
+            // the kernel reads the operands while writing to acc
+            acc += lhs * rhs;
+            return;
+        }
+    }
+    detail::mul_add_limbs(dst.data(), dst.size(), l.data(), l.size(),
+                          r.data(), r.size());
+    detail::mask_top_limb<acc_size>(dst);
+}
+
+template <std::size_t size, typename limb>
+constexpr static_uint<size, limb> fma(
+    static_uint<size, limb> const& a,
+    static_uint<size, limb> const& b,
+    static_uint<size, limb> const& c) noexcept {
+    auto result = c;
+    mac_into(result, a, b);
+    return result;
+}
+
+template <std::size_t size, typename limb>
+constexpr static_uint<2 * size, limb> fma_wide(
+    static_uint<size, limb> const& a,
+    static_uint<size, limb> const& b,
+    static_uint<size, limb> const& c) noexcept {
+    auto result = static_uint<2 * size, limb>{c};
+    mac_into(result, a, b);
+    return result;
+}
+
+/**
+ * static_uint_view: half of a static_uint's limbs, as returned by its
+ * hi() and lo(), which reads and writes them in place
+ * The limbs are in the same order as those of a static_uint<size>,
+ * so load and store are plain copies, and divide-and-conquer code can
+ * give limbs() straight to the limb kernels instead of splitting the
+ * value into copies
+ * A view shouldn't outlive the static_uint it was taken from
+ */
+template <std::size_t size, typename limb, bool writable>
+struct static_uint_view {
+    using value_type = static_uint<size, limb>;
+    using pointer = std::conditional_t<writable, limb*, limb const*>;
+    static constexpr auto limb_count =
+        detail::required_array_size(size, sizeof(limb));
+
+    constexpr explicit static_uint_view(pointer in) noexcept
+        : first{in} {}
+
+    constexpr pointer limbs() const noexcept { return first; }
+
+    constexpr value_type load() const noexcept {
+        auto result = value_type{};
+        auto& dst = detail::limb_access::get(result);
+        for (std::size_t i = 0; i < limb_count; ++i) {
+            dst[i] = first[i];
+        }
+        return result;
+    }
+    template <bool w = writable, typename = std::enable_if_t<w>>
+    constexpr void store(value_type const& value) const noexcept {
+        auto const& src = detail::limb_access::get(value);
+        for (std::size_t i = 0; i < limb_count; ++i) {
+            first[i] = src[i];
+        }
+    }
+
+  private:
+    pointer first;
+};
+
+/**
+ * The static_uint made of two halves, the inverse of hi() and lo()
+ */
+template <std::size_t size, typename limb>
+constexpr static_uint<2 * size, limb> join(
+    static_uint<size, limb> const& hi,
+    static_uint<size, limb> const& lo) noexcept {
+    auto result = static_uint<2 * size, limb>{};
+    result.hi().store(hi);
+    result.lo().store(lo);
+    return result;
+}
+
+/**
+ * Division giving both the quotient and the remainder
+ * Divisors that fit in one limb take a single pass over the dividend;
+ * others go through schoolbook long division
+ */
+template <typename uint>
+struct divmod_result {
+    uint quotient;
+    uint remainder;
+};
+
+template <std::size_t size, typename limb>
+constexpr divmod_result<static_uint<size, limb>> divmod(
+    static_uint<size, limb> const& lhs,
+    static_uint<size, limb> const& rhs) noexcept {
+    assert(rhs != 0 && "division by zero");
+    auto result = divmod_result<static_uint<size, limb>>{};
+    auto& q = detail::limb_access::get(result.quotient);
+    auto& r = detail::limb_access::get(result.remainder);
+    auto const& a = detail::limb_access::get(lhs);
+    auto const& b = detail::limb_access::get(rhs);
+
+    // only the significant limbs take part in the division
+    auto na = a.size();
+    while (na > 0 && a[na - 1] == 0) {
+        --na;
+    }
+    auto nb = b.size();
+    while (nb > 1 && b[nb - 1] == 0) {
+        --nb;
+    }
+    if (na < nb) {
+        result.remainder = lhs;
+    } else if (nb == 1) {
+        r[0] = detail::div_limb(q.data(), a.data(), na, b[0]);
+    } else {
+        constexpr auto n = detail::required_array_size(size,
+                                                       sizeof(limb));
+        auto un = std::array<limb, n + 1>{};
+        auto vn = std::array<limb, n>{};
+        detail::div_limbs(q.data(), r.data(), a.data(), na, b.data(),
+                          nb, un.data(), vn.data());
+    }
+    return result;
+}
+
+/**
+ * Bit counting, like std::countl_zero and std::bit_width for the
+ * declared size
+ */
+template <std::size_t size, typename limb>
+constexpr unsigned int countl_zero(
+    static_uint<size, limb> const& value) noexcept {
+    constexpr auto limb_bits = sizeof(limb) * CHAR_BIT;
+    auto const& limbs = detail::limb_access::get(value);
+    // unused bits of a partial top limb don't count
+    constexpr auto padding =
+        detail::required_array_size(size, sizeof(limb)) * limb_bits -
+        size;
+    unsigned int count = 0;
+    for (std::size_t i = limbs.size(); i != 0; --i) {
+        if (limbs[i - 1] != 0) {
+            return count + detail::countl_zero_limb(limbs[i - 1]) -
+                   padding;
+        }
+        count += limb_bits;
+    }
+    return size;
+}
+
+template <std::size_t size, typename limb>
+constexpr unsigned int bit_width(
+    static_uint<size, limb> const& value) noexcept {
+    return size - countl_zero(value);
+}
+
+/**
+ * Integer power by square-and-multiply, with whether the true result
+ * overflowed 'size' bits (the power itself wraps around)
+ */
+template <typename uint>
+struct pow_result {
+    uint power;
+    bool overflow;
+};
+
+template <std::size_t size, typename limb>
+constexpr pow_result<static_uint<size, limb>> ipow(
+    static_uint<size, limb> base, std::size_t exponent) noexcept {
+    auto result = pow_result<static_uint<size, limb>>{1, false};
+    // mul_overflow can't write over its operands
+    auto product = static_uint<size, limb>{};
+    while (exponent != 0) {
+        if ((exponent & 1) != 0) {
+            result.overflow =
+                detail::mul_overflow(result.power, base, product) ||
+                result.overflow;
+            result.power = product;
+        }
+        exponent >>= 1;
+        // the last square would be unused, and could overflow
+        if (exponent != 0) {
+            result.overflow =
+                detail::mul_overflow(base, base, product) ||
+                result.overflow;
+            base = product;
+        }
+    }
+    return result;
+}
+
+/**
+ * Integer logarithms, of nonzero values
+ * log10_floor estimates its result from the bit width and settles it
+ * with a comparison against the next power of ten (see
+ * detail::at_least_power_of_ten); num_digits is the number of
+ * decimal digits, 1 for 0
+ */
+template <std::size_t size, typename limb>
+constexpr unsigned int log2_floor(
+    static_uint<size, limb> const& value) noexcept {
+    assert(value != 0);
+    return bit_width(value) - 1;
+}
+
+namespace detail {
+/*
+ * floor(log10(2^n)), with log10(2) in 64-bit fixed point taken as two
+ * 32-bit halves; exact for every n below max_log10_bits
+ */
+constexpr std::size_t max_log10_bits = std::size_t{1} << 24;
+constexpr unsigned int log10_pow2(std::size_t n) noexcept {
+    auto const wide = static_cast<std::uint64_t>(n);
+    return static_cast<unsigned int>(
+        (wide * 1292913986u + ((wide * 2112355276u) >> 32)) >> 32);
+}
+
+/*
+ * Up to this size, every power of ten below 2^size is kept in a
+ * table built at compile time; the table grows with the square of
+ * the size, so wider values keep only the powers 10^(2^i) below
+ * 2^size and multiply together the ones they need
+ */
+constexpr std::size_t max_decimal_table_size = 1024;
+
+template <std::size_t size, typename limb>
+constexpr auto make_powers_of_ten() noexcept {
+    constexpr auto count = log10_pow2(size) + 1;
+    auto powers = std::array<static_uint<size, limb>, count>{};
+    powers[0] = static_uint<size, limb>{1};
+    for (std::size_t i = 1; i < count; ++i) {
+        powers[i] = powers[i - 1] * 10u;
+    }
+    return powers;
+}
+template <std::size_t size, typename limb>
+inline constexpr auto powers_of_ten_v =
+    make_powers_of_ten<size, limb>();
+
+template <std::size_t size, typename limb>
+constexpr auto make_squared_powers_of_ten() noexcept {
+    // one for each bit of the largest exponent, log10_pow2(size)
+    constexpr auto top = log10_pow2(size);
+    constexpr auto count =
+        sizeof(top) * CHAR_BIT - countl_zero_limb(top);
+    auto powers = std::array<static_uint<size, limb>, count>{};
+    powers[0] = static_uint<size, limb>{10};
+    for (std::size_t i = 1; i < count; ++i) {
+        powers[i] = powers[i - 1] * powers[i - 1];
+    }
+    return powers;
+}
+template <std::size_t size, typename limb>
+inline constexpr auto squared_powers_of_ten_v =
+    make_squared_powers_of_ten<size, limb>();
+
+// value >= 10^k, where 10^k may not fit
+template <std::size_t size, typename limb>
+constexpr bool at_least_power_of_ten(
+    static_uint<size, limb> const& value, unsigned int k) noexcept {
+    // 10^k < 2^size exactly when k <= log10_pow2(size)
+    if (k > log10_pow2(size)) {
+        return false;
+    }
+    if constexpr (size <= max_decimal_table_size) {
+        return value >= powers_of_ten_v<size, limb>[k];
+    } else {
+        // one multiplication per set bit of k past the lowest
+        constexpr auto const& squares =
+            squared_powers_of_ten_v<size, limb>;
+        auto power = static_uint<size, limb>{1};
+        auto first = true;
+        for (std::size_t i = 0; k != 0; ++i, k >>= 1) {
+            if ((k & 1) != 0) {
+                power = first ? squares[i] : power * squares[i];
+                first = false;
+            }
+        }
+        return value >= power;
+    }
+}
+}  // namespace detail
+
+template <std::size_t size, typename limb>
+constexpr unsigned int log10_floor(
+    static_uint<size, limb> const& value) noexcept {
+    static_assert(size <= detail::max_log10_bits,
+                  "The estimate from the bit width is only exact up "
+                  "to 2^24 bits");
+    assert(value != 0);
+    // the smallest value of this width is 2^(width - 1), and value is
+    // less than twice that, so the answer is at most one more
+    auto const result = detail::log10_pow2(bit_width(value) - 1);
+    return result + detail::at_least_power_of_ten(value, result + 1);
+}
+template <std::size_t size, typename limb>
+constexpr unsigned int num_digits(
+    static_uint<size, limb> const& value) noexcept {
+    return value == 0 ? 1 : log10_floor(value) + 1;
+}
+
+namespace detail {
+/*
+ * Number of decimal digits that always fit in a limb, 19 for 64-bit
+ * limbs and 9 for 32-bit ones, and ten to that power
+ */
+template <typename limb>
+constexpr unsigned int chunk_digits() noexcept {
+    unsigned int digits = 0;
+    for (auto max = static_cast<limb>(~limb{0}); max >= 10;
+         max /= 10) {
+        ++digits;
+    }
+    return digits;
+}
+template <typename limb>
+constexpr limb chunk_divisor() noexcept {
+    auto result = limb{1};
+    for (unsigned int i = 0; i < chunk_digits<limb>(); ++i) {
+        result *= 10;
+    }
+    return result;
+}
+
+// "00" to "99", so that digits are written two at a time
+constexpr std::array<char, 200> make_digit_pairs() noexcept {
+    auto pairs = std::array<char, 200>{};
+    for (std::size_t i = 0; i < 100; ++i) {
+        pairs[2 * i] = static_cast<char>('0' + i / 10);
+        pairs[2 * i + 1] = static_cast<char>('0' + i % 10);
+    }
+    return pairs;
+}
+inline constexpr auto digit_pairs = make_digit_pairs();
+
+/*
+ * Writes exactly 'digits' digits of value, zero-padded, backwards
+ * from end, and returns where they start
+ * With the constant chunk size the loop unrolls into straight-line
+ * code
+ */
+template <typename limb>
+constexpr char* write_chunk(char* end, limb value,
+                            unsigned int digits) noexcept {
+    for (; digits >= 2; digits -= 2) {
+        auto const pair = static_cast<std::size_t>(value % 100) * 2;
+        value /= 100;
+        end -= 2;
+        end[0] = digit_pairs[pair];
+        end[1] = digit_pairs[pair + 1];
+    }
+    if (digits != 0) {
+        *--end = static_cast<char>('0' + value);
+    }
+    return end;
+}
+}  // namespace detail
+
+/**
+ * Decimal representation, written into [first, last) like
+ * std::to_chars: on success ptr is past the last digit, otherwise it
+ * is last and ec is std::errc::value_too_large
+ * The length is known up front from num_digits, so digits go
+ * straight to their place, from the lowest: each single-limb
+ * division pass over the value yields a whole chunk of them (see
+ * detail::chunk_digits), and what is left is the top chunk
+ */
+template <std::size_t size, typename limb>
+constexpr std::to_chars_result to_chars(
+    char* first, char* last,
+    static_uint<size, limb> const& value) noexcept {
+    constexpr auto chunk = detail::chunk_digits<limb>();
+    constexpr auto divisor = detail::chunk_divisor<limb>();
+    auto const digits = num_digits(value);
+    if (static_cast<std::size_t>(last - first) < digits) {
+        return {last, std::errc::value_too_large};
+    }
+    auto quotient = value;
+    auto& limbs = detail::limb_access::get(quotient);
+    auto n = limbs.size();
+    auto end = first + digits;
+    auto const chunks = (digits - 1) / chunk;
+    for (unsigned int i = 0; i < chunks; ++i) {
+        while (limbs[n - 1] == 0) {
+            --n;
+        }
+        auto const low =
+            detail::div_limb(limbs.data(), limbs.data(), n, divisor);
+        end = detail::write_chunk(end, low, chunk);
+    }
+    // what is left has at most 'chunk' digits, in the lowest limb
+    detail::write_chunk(end, limbs[0], digits - chunks * chunk);
+    return {first + digits, std::errc{}};
+}
+
+namespace detail {
+/*
+ * 2^n, exactly (or infinity) since only powers of two are multiplied
+ */
+template <typename floating>
+constexpr floating pow2_floating(std::size_t n) noexcept {
+    auto result = floating{1};
+    for (auto base = floating{2}; n != 0; n >>= 1, base *= base) {
+        if ((n & 1) != 0) {
+            result *= base;
+        }
+    }
+    return result;
+}
+
+/*
+ * The value rounded to the nearest floating (ties to even)
+ * Only the top 'digits' bits are converted, rounded with the next bit
+ * and a sticky bit ORing all the others together, so the one rounding
+ * step is the final one
+ */
+template <typename floating, std::size_t size, typename limb>
+constexpr floating to_floating(
+    static_uint<size, limb> const& value) noexcept {
+    constexpr auto digits = std::numeric_limits<floating>::digits;
+    constexpr auto limb_bits = sizeof(limb) * CHAR_BIT;
+    auto const width = bit_width(value);
+    auto const shift = width > digits ? width - digits : 0;
+    auto top = value >> shift;
+    if (shift != 0) {
+        auto const& limbs = limb_access::get(value);
+        auto const round_bit = shift - 1;
+        auto const index = round_bit / limb_bits;
+        auto const bit = round_bit % limb_bits;
+        auto sticky = static_cast<limb>(
+            limbs[index] & ((limb{1} << bit) - 1));
+        for (std::size_t i = 0; i < index; ++i) {
+            sticky |= limbs[i];
+        }
+        if (((limbs[index] >> bit) & 1) != 0 &&
+            (sticky != 0 || (top & 1u) != 0)) {
+            // at most 2^digits, which is still exact
+            ++top;
+        }
+    }
+    // top has at most digits + 1 bits, in its lowest limbs
+    constexpr auto top_limbs = (digits + limb_bits) / limb_bits;
+    constexpr auto n = required_array_size(size, sizeof(limb));
+    auto const& limbs = limb_access::get(top);
+    auto result = floating{0};
+    for (auto i = top_limbs < n ? top_limbs : n; i != 0; --i) {
+        result = result * pow2_floating<floating>(limb_bits) +
+                 static_cast<floating>(limbs[i - 1]);
+    }
+    return result * pow2_floating<floating>(shift);
+}
+
+/*
+ * The integral part of a floating, wrapped around at 'size' bits
+ * The significand is taken apart into limbs exactly, then shifted
+ * into place
+ */
+template <std::size_t size, typename limb, typename floating>
+static_uint<size, limb> from_floating(floating in) noexcept {
+    constexpr auto digits = std::numeric_limits<floating>::digits;
+    constexpr auto limb_bits = sizeof(limb) * CHAR_BIT;
+    constexpr auto wide = size > digits ? size : digits;
+    // also NaN, while infinity has no bits to take
+    if (!(in >= 1) ||
+        in == std::numeric_limits<floating>::infinity()) {
+        return static_uint<size, limb>{};
+    }
+    int exponent = 0;
+    auto significand = std::ldexp(std::frexp(in, &exponent), digits);
+    auto const radix = pow2_floating<floating>(limb_bits);
+    auto result = static_uint<wide, limb>{};
+    auto& limbs = limb_access::get(result);
+    for (std::size_t i = 0; significand != 0; ++i) {
+        auto const low = std::fmod(significand, radix);
+        limbs[i] = static_cast<limb>(low);
+        significand = (significand - low) / radix;
+    }
+    // in = significand * 2^(exponent - digits)
+    if (exponent >= digits) {
+        result <<= static_cast<unsigned int>(exponent - digits);
+    } else {
+        result >>= static_cast<unsigned int>(digits - exponent);
+    }
+    return truncate<size>(result);
+}
+}  // namespace detail
+
+/**
+ * Conversions to floating point round to nearest, ties to even, like
+ * those of built-in integers, and give infinity past the largest
+ * finite value
+ * Conversions from floating point keep the integral part, which is
+ * exact, and wrap it around at 'size' bits; negative values,
+ * infinity and NaN give 0
+ */
+template <std::size_t size, typename limb>
+constexpr double to_double(
+    static_uint<size, limb> const& value) noexcept {
+    return detail::to_floating<double>(value);
+}
+template <std::size_t size, typename limb>
+constexpr long double to_long_double(
+    static_uint<size, limb> const& value) noexcept {
+    return detail::to_floating<long double>(value);
+}
+template <std::size_t size, typename limb = std::uint64_t>
+static_uint<size, limb> from_double(double in) noexcept {
+    return detail::from_floating<size, limb>(in);
+}
+template <std::size_t size, typename limb = std::uint64_t>
+static_uint<size, limb> from_long_double(long double in) noexcept {
+    return detail::from_floating<size, limb>(in);
+}
+
+/**
+ * Exact sums and dot products of up to max_count values
+ * The result is wide enough that it can never overflow, and values
+ * are added straight into it: the carries out of the values' width
+ * are counted in a single limb and only added to the top limbs at the
+ * end
+ */
+template <std::size_t max_count, std::size_t size, typename limb>
+constexpr static_uint<size + detail::bits_needed(max_count), limb>
+exact_sum(static_uint<size, limb> const* values,
+          std::size_t count) noexcept {
+    static_assert(detail::bits_needed(max_count) <=
+                      sizeof(limb) * CHAR_BIT,
+                  "The carry count must fit in a limb");
+    assert(count <= max_count);
+    constexpr auto result_size =
+        size + detail::bits_needed(max_count);
+    constexpr auto n =
+        detail::required_array_size(size, sizeof(limb));
+    auto result = static_uint<result_size, limb>{};
+    auto& dst = detail::limb_access::get(result);
+    limb carries = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        auto const& src = detail::limb_access::get(values[i]);
+        carries += detail::add_limbs(dst.data(), n, src.data(), n);
+    }
+    // without an extra limb, the sum always fits in the first n
+    if constexpr (detail::required_array_size(result_size,
+                                              sizeof(limb)) > n) {
+        dst[n] = carries;
+    }
+    return result;
+}
+
+template <std::size_t max_count, std::size_t size, typename limb>
+constexpr static_uint<2 * size + detail::bits_needed(max_count), limb>
+exact_dot(static_uint<size, limb> const* lhs,
+          static_uint<size, limb> const* rhs,
+          std::size_t count) noexcept {
+    assert(count <= max_count);
+    constexpr auto result_size =
+        2 * size + detail::bits_needed(max_count);
+    auto result = static_uint<result_size, limb>{};
+    for (std::size_t i = 0; i < count; ++i) {
+        mac_into(result, lhs[i], rhs[i]);
+    }
+    return result;
+}
+
+namespace detail {
+/*
+ * Value of an integer literal's characters, with the prefixes and
+ * digit separators of built-in integer literals
+ * Empty if a digit is invalid for the base or the value doesn't fit
+ */
+template <std::size_t size, typename limb, char... chars>
+constexpr std::optional<static_uint<size, limb>>
+parse_literal() noexcept {
+    constexpr char text[] = {chars...};
+    constexpr auto length = sizeof...(chars);
+    std::size_t i = 0;
+    auto base = 10u;
+    if (length > 1 && text[0] == '0') {
+        if (text[1] == 'x' || text[1] == 'X') {
+            base = 16;
+            i = 2;
+        } else if (text[1] == 'b' || text[1] == 'B') {
+            base = 2;
+            i = 2;
+        } else {
+            base = 8;
+            i = 1;
+        }
+    }
+    auto result = std::optional{static_uint<size, limb>{}};
+    for (; i < length && result; ++i) {
+        auto const c = text[i];
+        if (c == '\'') {
+            continue;
+        }
+        auto digit = 16u;
+        if (c >= '0' && c <= '9') {
+            digit = static_cast<unsigned int>(c - '0');
+        } else if (c >= 'a' && c <= 'f') {
+            digit = static_cast<unsigned int>(c - 'a' + 10);
+        } else if (c >= 'A' && c <= 'F') {
+            digit = static_cast<unsigned int>(c - 'A' + 10);
+        }
+        if (digit >= base) {
+            return std::nullopt;
+        }
+        result = checked_mul(*result, static_uint<size, limb>{base});
+        if (result) {
+            result = checked_add(*result,
+                                 static_uint<size, limb>{digit});
+        }
+    }
+    return result;
+}
+}  // namespace detail
+
+/**
+ * Literals for the common sizes, in decimal, octal, hexadecimal (0x)
+ * or binary (0b), parsed at compile time:
+ *     using namespace static_uint_literals;
+ *     constexpr auto p = 0xffffffff'ffffffff'ffffffff'fffffffd_u128;
+ * A literal that doesn't fit is a compile error
+ */
+namespace static_uint_literals {
+template <char... chars>
+constexpr static_uint<128> operator""_u128() noexcept {
+    constexpr auto value =
+        detail::parse_literal<128, std::uint64_t, chars...>();
+    static_assert(value.has_value(),
+                  "Literal doesn't fit in a static_uint<128>");
+    return *value;
+}
+template <char... chars>
+constexpr static_uint<256> operator""_u256() noexcept {
+    constexpr auto value =
+        detail::parse_literal<256, std::uint64_t, chars...>();
+    static_assert(value.has_value(),
+                  "Literal doesn't fit in a static_uint<256>");
+    return *value;
+}
+template <char... chars>
+constexpr static_uint<512> operator""_u512() noexcept {
+    constexpr auto value =
+        detail::parse_literal<512, std::uint64_t, chars...>();
+    static_assert(value.has_value(),
+                  "Literal doesn't fit in a static_uint<512>");
+    return *value;
+}
+}  // namespace static_uint_literals
@@ -0,0 +1,321 @@
+#pragma once
+
+#include <qg/static_uint.hpp>
+
+#include <climits>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * Opt-in expression templates for static_uint
+ * Wrapping an operand in lazy() makes the operators build an
+ * expression instead of a temporary for every intermediate result,
+ * and the whole expression is then computed in one pass over the
+ * limbs when it is converted to a static_uint (or given to eval):
+ *     static_uint<2048> r = (lazy(a) + b + c) & (mask >> 3);
+ * Bitwise operations and shifts are computed limb by limb, additions
+ * and subtractions keep their carry from one limb to the next
+ * Shifts need random access to their operand's limbs, so a shifted
+ * addition or subtraction is computed into a temporary first
+ * Expressions refer to their static_uint operands, and shouldn't
+ * outlive them
+ */
+namespace static_uint_expr {
+/*
+ * Every node produces the limbs of its value from least to most
+ * significant through get(i), with the unused bits of a partial top
+ * limb cleared
+ * Nodes that are random_access may be asked for their limbs in any
+ * order; the others (carry chains) need them in order
+ */
+template <typename derived, std::size_t size, typename limb>
+struct node {
+    using value_type = static_uint<size, limb>;
+    using limb_type = limb;
+    static constexpr std::size_t bits = size;
+    static constexpr std::size_t n =
+        detail::required_array_size(size, sizeof(limb));
+    static constexpr auto limb_bits = sizeof(limb) * CHAR_BIT;
+
+    static constexpr limb mask(std::size_t i, limb value) noexcept {
+        if (i == n - 1) {
+            value &= detail::top_limb_mask<limb>(size);
+        }
+        return value;
+    }
+
+    constexpr operator value_type() const noexcept {
+        auto expression = static_cast<derived const&>(*this);
+        auto result = value_type{};
+        auto& dst = detail::limb_access::get(result);
+        for (std::size_t i = 0; i < n; ++i) {
+            dst[i] = expression.get(i);
+        }
+        return result;
+    }
+};
+
+template <typename T>
+struct is_node {
+    template <typename derived, std::size_t size, typename limb>
+    static std::true_type test(node<derived, size, limb> const*);
+    static std::false_type test(...);
+
+    static constexpr bool value =
+        decltype(test(std::declval<T const*>()))::value;
+};
+template <typename T>
+constexpr bool is_node_v = is_node<T>::value;
+
+template <std::size_t size, typename limb>
+struct leaf : node<leaf<size, limb>, size, limb> {
+    static constexpr bool random_access = true;
+    static_uint<size, limb> const* value;
+
+    constexpr explicit leaf(
+        static_uint<size, limb> const& in) noexcept
+        : value{&in} {}
+    constexpr limb get(std::size_t i) const noexcept {
+        return detail::limb_access::get(*value)[i];
+    }
+};
+
+// a subexpression computed ahead of time, for shifts of carry chains
+template <std::size_t size, typename limb>
+struct computed : node<computed<size, limb>, size, limb> {
+    static constexpr bool random_access = true;
+    static_uint<size, limb> value;
+
+    template <typename expression>
+    constexpr explicit computed(expression const& e) noexcept
+        : value{e} {}
+    constexpr limb get(std::size_t i) const noexcept {
+        return detail::limb_access::get(value)[i];
+    }
+};
+
+template <typename lhs_t, typename rhs_t, typename op>
+struct bitwise
+    : node<bitwise<lhs_t, rhs_t, op>, lhs_t::bits,
+           typename lhs_t::limb_type> {
+    static constexpr bool random_access =
+        lhs_t::random_access && rhs_t::random_access;
+    lhs_t lhs;
+    rhs_t rhs;
+
+    constexpr bitwise(lhs_t l, rhs_t r) noexcept : lhs{l}, rhs{r} {}
+    constexpr auto get(std::size_t i) noexcept {
+        return op::apply(lhs.get(i), rhs.get(i));
+    }
+};
+
+struct and_op {
+    template <typename limb>
+    static constexpr limb apply(limb lhs, limb rhs) noexcept {
+        return lhs & rhs;
+    }
+};
+struct or_op {
+    template <typename limb>
+    static constexpr limb apply(limb lhs, limb rhs) noexcept {
+        return lhs | rhs;
+    }
+};
+struct xor_op {
+    template <typename limb>
+    static constexpr limb apply(limb lhs, limb rhs) noexcept {
+        return lhs ^ rhs;
+    }
+};
+
+template <typename operand_t>
+struct complement
+    : node<complement<operand_t>, operand_t::bits,
+           typename operand_t::limb_type> {
+    static constexpr bool random_access = operand_t::random_access;
+    operand_t operand;
+
+    constexpr explicit complement(operand_t o) noexcept
+        : operand{o} {}
+    constexpr auto get(std::size_t i) noexcept {
+        using limb = typename operand_t::limb_type;
+        return this->mask(i, static_cast<limb>(~operand.get(i)));
+    }
+};
+
+template <typename lhs_t, typename rhs_t, bool subtract>
+struct carry_chain
+    : node<carry_chain<lhs_t, rhs_t, subtract>,
+           lhs_t::bits,
+           typename lhs_t::limb_type> {
+    static constexpr bool random_access = false;
+    lhs_t lhs;
+    rhs_t rhs;
+    bool carry = false;
+
+    constexpr carry_chain(lhs_t l, rhs_t r) noexcept
+        : lhs{l}, rhs{r} {}
+    constexpr auto get(std::size_t i) noexcept {
+        if constexpr (subtract) {
+            return this->mask(
+                i, detail::sub_borrow(lhs.get(i), rhs.get(i), carry));
+        } else {
+            return this->mask(
+                i, detail::add_carry(lhs.get(i), rhs.get(i), carry));
+        }
+    }
+};
+
+template <typename operand_t, bool left>
+struct shift
+    : node<shift<operand_t, left>, operand_t::bits,
+           typename operand_t::limb_type> {
+    static_assert(operand_t::random_access,
+                  "Shifted operands need random access to limbs");
+    static constexpr bool random_access = true;
+    operand_t operand;
+    unsigned int amount;
+
+    constexpr shift(operand_t o, unsigned int a) noexcept
+        : operand{o}, amount{a} {}
+    constexpr auto get(std::size_t i) noexcept {
+        using limb = typename operand_t::limb_type;
+        constexpr auto n = shift::n;
+        constexpr auto limb_bits = shift::limb_bits;
+        if (amount >= operand_t::bits) {
+            return limb{0};
+        }
+        auto const limb_shift = amount / limb_bits;
+        auto const bit_shift = amount % limb_bits;
+        if constexpr (left) {
+            if (i < limb_shift) {
+                return limb{0};
+            }
+            auto const src = i - limb_shift;
+            auto value =
+                static_cast<limb>(operand.get(src) << bit_shift);
+            if (bit_shift != 0 && src > 0) {
+                value |=
+                    operand.get(src - 1) >> (limb_bits - bit_shift);
+            }
+            return this->mask(i, value);
+        } else {
+            auto const src = i + limb_shift;
+            if (src >= n) {
+                return limb{0};
+            }
+            auto value =
+                static_cast<limb>(operand.get(src) >> bit_shift);
+            if (bit_shift != 0 && src + 1 < n) {
+                value |=
+                    operand.get(src + 1) << (limb_bits - bit_shift);
+            }
+            return value;
+        }
+    }
+};
+
+/*
+ * Operands of the operators: nodes as they are, static_uints as
+ * leaves, and carry chains computed ahead of a shift
+ */
+template <std::size_t size, typename limb>
+constexpr leaf<size, limb> as_node(
+    static_uint<size, limb> const& value) noexcept {
+    return leaf<size, limb>{value};
+}
+template <typename T, typename = std::enable_if_t<is_node_v<T>>>
+constexpr T as_node(T const& value) noexcept {
+    return value;
+}
+template <typename T>
+using node_t = decltype(as_node(std::declval<T const&>()));
+
+template <typename T>
+constexpr auto as_random_access(T const& value) noexcept {
+    using operand_t = node_t<T>;
+    if constexpr (operand_t::random_access) {
+        return as_node(value);
+    } else {
+        using limb = typename operand_t::limb_type;
+        return computed<operand_t::bits, limb>{as_node(value)};
+    }
+}
+
+// at least one operand has to be an expression already
+template <typename lhs_t, typename rhs_t>
+using enable_binary_t =
+    std::enable_if_t<(is_node_v<lhs_t> || is_node_v<rhs_t>) &&
+                     std::is_same_v<
+                         typename node_t<lhs_t>::value_type,
+                         typename node_t<rhs_t>::value_type>>;
+
+/**
+ * Entry point: the static_uint as the leaf of an expression
+ */
+template <std::size_t size, typename limb>
+constexpr leaf<size, limb> lazy(
+    static_uint<size, limb> const& value) noexcept {
+    return leaf<size, limb>{value};
+}
+
+/**
+ * Computes an expression into a static_uint
+ */
+template <typename T, typename = std::enable_if_t<is_node_v<T>>>
+constexpr typename T::value_type eval(T const& expression) noexcept {
+    return expression;
+}
+
+template <typename lhs_t, typename rhs_t,
+          typename = enable_binary_t<lhs_t, rhs_t>>
+constexpr auto operator+(lhs_t const& lhs,
+                         rhs_t const& rhs) noexcept {
+    return carry_chain<node_t<lhs_t>, node_t<rhs_t>, false>{
+        as_node(lhs), as_node(rhs)};
+}
+template <typename lhs_t, typename rhs_t,
+          typename = enable_binary_t<lhs_t, rhs_t>>
+constexpr auto operator-(lhs_t const& lhs,
+                         rhs_t const& rhs) noexcept {
+    return carry_chain<node_t<lhs_t>, node_t<rhs_t>, true>{
+        as_node(lhs), as_node(rhs)};
+}
+template <typename lhs_t, typename rhs_t,
+          typename = enable_binary_t<lhs_t, rhs_t>>
+constexpr auto operator&(lhs_t const& lhs,
+                         rhs_t const& rhs) noexcept {
+    return bitwise<node_t<lhs_t>, node_t<rhs_t>, and_op>{
+        as_node(lhs), as_node(rhs)};
+}
+template <typename lhs_t, typename rhs_t,
+          typename = enable_binary_t<lhs_t, rhs_t>>
+constexpr auto operator|(lhs_t const& lhs,
+                         rhs_t const& rhs) noexcept {
+    return bitwise<node_t<lhs_t>, node_t<rhs_t>, or_op>{
+        as_node(lhs), as_node(rhs)};
+}
+template <typename lhs_t, typename rhs_t,
+          typename = enable_binary_t<lhs_t, rhs_t>>
+constexpr auto operator^(lhs_t const& lhs,
+                         rhs_t const& rhs) noexcept {
+    return bitwise<node_t<lhs_t>, node_t<rhs_t>, xor_op>{
+        as_node(lhs), as_node(rhs)};
+}
+template <typename T, typename = std::enable_if_t<is_node_v<T>>>
+constexpr auto operator~(T const& operand) noexcept {
+    return complement<T>{operand};
+}
+template <typename T, typename = std::enable_if_t<is_node_v<T>>>
+constexpr auto operator>>(T const& operand,
+                          unsigned int amount) noexcept {
+    auto const o = as_random_access(operand);
+    return shift<std::remove_const_t<decltype(o)>, false>{o, amount};
+}
+template <typename T, typename = std::enable_if_t<is_node_v<T>>>
+constexpr auto operator<<(T const& operand,
+                          unsigned int amount) noexcept {
+    auto const o = as_random_access(operand);
+    return shift<std::remove_const_t<decltype(o)>, true>{o, amount};
+}
+}  // namespace static_uint_expr
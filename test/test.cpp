@@ -1,4 +1,11 @@
+#include <qg/bounded_uint.hpp>
+#include <qg/carry_save_uint.hpp>
+#include <qg/fixed.hpp>
+#include <qg/mod_uint.hpp>
+#include <qg/packed_static_uint.hpp>
+#include <qg/static_int.hpp>
 #include <qg/static_uint.hpp>
+#include <qg/static_uint_expr.hpp>
 
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "doctest.h"
@@ -7,17 +14,19 @@
 #include <array>
 #include <cstdint>
 #include <numeric>
+#include <sstream>
+#include <string>
 
 /*
- * Test-only printing of static_uint until a good solution is built in
+ * Printing of static_uint in test failures, in decimal
  */
-template <std::size_t size>
+template <std::size_t size, typename limb>
 std::ostream& operator<<(std::ostream& os,
-                         static_uint<size> const& u) {
-    for (auto const& d : u) {
-        os << d;
-    }
-    return os;
+                         static_uint<size, limb> const& u) {
+    // at most size * log10(2) + 1 digits
+    char buffer[size / 3 + 1];
+    auto const result = to_chars(buffer, buffer + sizeof(buffer), u);
+    return os.write(buffer, result.ptr - buffer);
 }
 
 TEST_CASE("default construction") {
@@ -92,6 +101,232 @@ TEST_CASE("right shifting more than 64 bits") {
     }
 }
 
+TEST_CASE("increment and decrement") {
+    constexpr auto size_t_max =
+        std::numeric_limits<std::size_t>::max();
+    using u128 = static_uint<2 * sizeof(std::size_t) * CHAR_BIT>;
+
+    SUBCASE("carry into the next limb") {
+        auto u = u128{size_t_max};
+        ++u;
+        constexpr std::array<std::size_t, 2> expected{1, 0};
+        CHECK(std::equal(u.begin(), u.end(), expected.begin(),
+                         expected.end()));
+        --u;
+        CHECK(u == size_t_max);
+    }
+    SUBCASE("wrap around") {
+        auto u = std::numeric_limits<u128>::max();
+        ++u;
+        CHECK(u == 0);
+        --u;
+        CHECK(u == std::numeric_limits<u128>::max());
+    }
+    SUBCASE("postfix returns the previous value") {
+        auto u = u128{41};
+        CHECK(u++ == 41);
+        CHECK(u == 42);
+        CHECK(u-- == 42);
+        CHECK(u == 41);
+    }
+    SUBCASE("constexpr") {
+        constexpr auto incremented = [] {
+            auto u = u128{size_t_max};
+            return ++u;
+        }();
+        static_assert(incremented == u128{size_t_max} + 1);
+        CHECK(incremented == u128{size_t_max} + 1);
+    }
+}
+
+TEST_CASE("operations with built-in integers") {
+    constexpr auto size_t_max =
+        std::numeric_limits<std::size_t>::max();
+    using u256 = static_uint<256>;
+    constexpr auto u256_max = std::numeric_limits<u256>::max();
+
+    SUBCASE("comparisons") {
+        static_assert(u256{5} == 5);
+        static_assert(5 == u256{5});
+        static_assert(u256{5} != 6);
+        static_assert(u256{5} < 6);
+        static_assert(4 < u256{5});
+        static_assert(u256_max > size_t_max);
+        static_assert(size_t_max < u256_max);
+        static_assert(u256_max >= 0);
+        static_assert(0 <= u256_max);
+    }
+    SUBCASE("addition carries across limbs") {
+        constexpr auto u = u256{size_t_max} + 1;
+        static_assert(u == (u256{size_t_max} + u256{1}));
+        CHECK((u256_max + 1) == 0);
+        CHECK((1 + u256{size_t_max}) == u);
+    }
+    SUBCASE("subtraction borrows across limbs") {
+        auto u = u256{size_t_max} + 1;
+        u -= 1;
+        CHECK(u == size_t_max);
+        CHECK((u256{0} - 1) == u256_max);
+    }
+    SUBCASE("multiplication") {
+        constexpr auto u = u256{size_t_max} * 2;
+        static_assert(u == (u256{size_t_max} + u256{size_t_max}));
+        CHECK((3 * u256{7}) == 21);
+        CHECK((u256_max * 2) == (u256_max - 1));
+    }
+    SUBCASE("bitwise and") {
+        CHECK((u256_max & 0xff) == 0xff);
+        CHECK((0xf0 & u256{0x3c}) == 0x30);
+        auto u = u256_max;
+        u &= 1;
+        CHECK(u == 1);
+    }
+}
+
+TEST_CASE("same-width subtraction and multiplication") {
+    using u256 = static_uint<256>;
+    constexpr auto u256_max = std::numeric_limits<u256>::max();
+    constexpr auto size_t_max =
+        std::numeric_limits<std::size_t>::max();
+
+    CHECK((u256{0} - u256{1}) == u256_max);
+    CHECK((u256_max - u256_max) == 0);
+    CHECK((u256_max * u256_max) == 1);
+
+    // (2^64 - 1)^2 == 2^128 - 2^65 + 1
+    constexpr auto square = u256{size_t_max} * u256{size_t_max};
+    constexpr auto expected =
+        (u256_max >> 128) - u256{size_t_max} - u256{size_t_max};
+    static_assert(square == expected);
+    CHECK(square == expected);
+}
+
+TEST_CASE("mixed-width operations") {
+    using u128 = static_uint<128>;
+    using u256 = static_uint<256>;
+    constexpr auto u128_max = std::numeric_limits<u128>::max();
+    constexpr auto u256_max = std::numeric_limits<u256>::max();
+
+    static_assert(
+        std::is_same_v<common_static_uint_t<128, 256>, u256>);
+    static_assert(
+        std::is_same_v<std::common_type_t<u256, u128>, u256>);
+
+    SUBCASE("comparisons") {
+        CHECK(u128_max == u256{u128_max});
+        CHECK(u256{u128_max} == u128_max);
+        CHECK(u128_max < u256_max);
+        CHECK(u256_max > u128_max);
+        CHECK(u128{0} != u256_max);
+    }
+    SUBCASE("arithmetic") {
+        constexpr auto sum = u128_max + u256{1};
+        static_assert(std::is_same_v<decltype(sum), u256 const>);
+        CHECK(sum == (u256{u128_max} + u256{1}));
+        CHECK((u256{1} + u128_max) == sum);
+        CHECK((sum - u128_max) == 1);
+        CHECK((u128{1} - u256{2}) == u256_max);
+        CHECK((u128_max * u256{2}) == (u256{u128_max} + u128_max));
+        CHECK((u256_max & u128_max) == u256{u128_max});
+    }
+}
+
+TEST_CASE("carry-out, checked and saturating arithmetic") {
+    using u256 = static_uint<256>;
+    constexpr auto u256_max = std::numeric_limits<u256>::max();
+    constexpr auto size_t_max =
+        std::numeric_limits<std::size_t>::max();
+
+    SUBCASE("add_with_carry") {
+        constexpr auto no_carry = add_with_carry(u256{1}, u256{2});
+        static_assert(no_carry.sum == 3 && !no_carry.carry_out);
+
+        auto const [sum, carry_out] =
+            add_with_carry(u256_max, u256{1});
+        CHECK(sum == 0);
+        CHECK(carry_out);
+
+        auto const with_carry_in =
+            add_with_carry(u256_max, u256_max, true);
+        CHECK(with_carry_in.sum == u256_max);
+        CHECK(with_carry_in.carry_out);
+    }
+    SUBCASE("sub_with_borrow") {
+        auto const [difference, borrow_out] =
+            sub_with_borrow(u256{0}, u256{1});
+        CHECK(difference == u256_max);
+        CHECK(borrow_out);
+        CHECK_FALSE(sub_with_borrow(u256{1}, u256{1}).borrow_out);
+        CHECK(sub_with_borrow(u256{1}, u256{0}, true).difference ==
+              0);
+    }
+    SUBCASE("checked") {
+        static_assert(checked_add(u256{1}, u256{2}) == u256{3});
+        CHECK_FALSE(checked_add(u256_max, u256{1}).has_value());
+        CHECK_FALSE(checked_sub(u256{1}, u256{2}).has_value());
+        CHECK(checked_mul(u256{size_t_max}, u256{size_t_max})
+                  .has_value());
+        CHECK(checked_mul(u256_max, u256{1}) == u256_max);
+        CHECK_FALSE(checked_mul(u256_max, u256{2}).has_value());
+        // only the carry out of the top limb overflows
+        CHECK_FALSE(
+            checked_mul(u256_max >> 64, u256{size_t_max} + 2)
+                .has_value());
+        // 2^128 * 2^128 overflows without any carry being produced
+        constexpr auto two_pow_128 =
+            (u256{size_t_max} + 1) * (u256{size_t_max} + 1);
+        CHECK_FALSE(
+            checked_mul(two_pow_128, two_pow_128).has_value());
+        CHECK(checked_mul(two_pow_128, u256{size_t_max}).has_value());
+    }
+    SUBCASE("saturating") {
+        CHECK(saturating_add(u256_max, u256{1}) == u256_max);
+        CHECK(saturating_add(u256{1}, u256{1}) == 2);
+        CHECK(saturating_sub(u256{1}, u256{2}) == 0);
+        CHECK(saturating_sub(u256{2}, u256{1}) == 1);
+        CHECK(saturating_mul(u256_max, u256{2}) == u256_max);
+        CHECK(saturating_mul(u256{3}, u256{2}) == 6);
+    }
+}
+
+TEST_CASE("widening and fused multiplications") {
+    using u128 = static_uint<128>;
+    using u256 = static_uint<256>;
+    constexpr auto u128_max = std::numeric_limits<u128>::max();
+    constexpr auto u256_max = std::numeric_limits<u256>::max();
+
+    SUBCASE("mul_wide") {
+        // (2^128 - 1)^2 == 2^256 - 2^129 + 1
+        constexpr auto square = mul_wide(u128_max, u128_max);
+        static_assert(std::is_same_v<decltype(square), u256 const>);
+        CHECK(square == u256_max - u256{u128_max} - u128_max);
+    }
+    SUBCASE("fma") {
+        static_assert(fma(u256{3}, u256{4}, u256{5}) == 17);
+        CHECK(fma(u256_max, u256{2}, u256{2}) == 0);
+        CHECK(fma(u256{u128_max}, u256{u128_max}, u256{u128_max}) ==
+              u256{u128_max} * u256{u128_max} + u256{u128_max});
+    }
+    SUBCASE("fma_wide") {
+        // (2^128 - 1)^2 + (2^128 - 1) == 2^256 - 2^128
+        constexpr auto result =
+            fma_wide(u128_max, u128_max, u128_max);
+        static_assert(std::is_same_v<decltype(result), u256 const>);
+        CHECK(result == u256_max - u256{u128_max});
+    }
+    SUBCASE("mac_into") {
+        auto acc = u256{};
+        for (int i = 0; i < 4; ++i) {
+            mac_into(acc, u128_max, u128_max);
+        }
+        CHECK(acc == mul_wide(u128_max, u128_max) * 4);
+
+        auto self = u128{3};
+        mac_into(self, self, self);
+        CHECK(self == 12);
+    }
+}
+
 TEST_CASE("operator+") {
     // some checks shamelessly lifted from
     // https://github.com/cerevra/int/
@@ -152,8 +387,987 @@ TEST_CASE("operator+") {
         CHECK(it[63] == 2);
     }
 }
-/*
-static_assert(static_uint<256>{
-                  std::numeric_limits<static_uint<255>>::max()} <
-              std::numeric_limits<static_uint<256>>::max());
-*/
+
+TEST_CASE("sizes that aren't a multiple of the limb size") {
+    using u72 = static_uint<72>;
+    using u200 = static_uint<200>;
+    constexpr auto u72_max = std::numeric_limits<u72>::max();
+    constexpr auto u200_max = std::numeric_limits<u200>::max();
+    constexpr auto size_t_max =
+        std::numeric_limits<std::size_t>::max();
+
+    static_assert(static_uint<256>{
+                      std::numeric_limits<static_uint<255>>::max()} <
+                  std::numeric_limits<static_uint<256>>::max());
+
+    SUBCASE("max") {
+        CHECK((u72_max >> 64) == 0xff);
+        CHECK((u200_max >> 192) == 0xff);
+        CHECK((std::numeric_limits<static_uint<4>>::max()) == 0xf);
+    }
+    SUBCASE("wrap around at the declared size") {
+        CHECK((u72_max + 1) == 0);
+        CHECK((u200_max + u200{2}) == 1);
+        CHECK((u72{0} - 1) == u72_max);
+        CHECK((u200{0} - u200{1}) == u200_max);
+        CHECK((u72_max * u72_max) == 1);
+        CHECK((u200_max * 2) == u200_max - 1);
+        CHECK((static_uint<4>{0x1f}) == 0xf);
+
+        auto u = u72_max;
+        CHECK(++u == 0);
+        CHECK(--u == u72_max);
+    }
+    SUBCASE("carries and overflow use the declared size") {
+        CHECK(add_with_carry(u72_max, u72{1}).carry_out);
+        CHECK_FALSE(
+            add_with_carry(u72{size_t_max}, u72{1}).carry_out);
+        CHECK_FALSE(checked_add(u200_max, u200{1}).has_value());
+        CHECK_FALSE(checked_mul(u72{size_t_max}, u72{0x101})
+                        .has_value());
+        CHECK(checked_mul(u72{size_t_max}, u72{0x100}).has_value());
+        CHECK(saturating_mul(u72_max, u72{2}) == u72_max);
+    }
+    SUBCASE("mixed widths") {
+        CHECK((u72_max + u200{1}) == (u200{u72_max} + 1));
+        CHECK(((u72_max + u200{1}) >> 72) == 1);
+        CHECK((u72{1} - u200{2}) == u200_max);
+    }
+}
+
+#if defined(__SIZEOF_INT128__)
+__extension__ using uint128_limb = unsigned __int128;
+using limb_types =
+    doctest::Types<std::uint32_t, std::uint64_t, uint128_limb>;
+#else
+using limb_types = doctest::Types<std::uint32_t, std::uint64_t>;
+#endif
+
+TEST_CASE_TEMPLATE("limb types", limb, limb_types) {
+    using u256 = static_uint<256, limb>;
+    constexpr auto u256_max = std::numeric_limits<u256>::max();
+    constexpr auto size_t_max =
+        std::numeric_limits<std::size_t>::max();
+
+    static_assert(std::is_same_v<typename u256::limb_type, limb>);
+    static_assert(sizeof(u256) == 32);
+    static_assert(sizeof(static_uint<96, std::uint32_t>) == 12);
+
+    CHECK((u256{size_t_max} >> 32) == (size_t_max >> 32));
+    CHECK((u256_max + 1) == 0);
+    CHECK((u256{0} - 1) == u256_max);
+    CHECK((u256_max >> 255) == 1);
+
+    // (2^64 - 1)^2 == 2^128 - 2^65 + 1
+    auto const square = u256{size_t_max} * u256{size_t_max};
+    CHECK(square ==
+          (u256_max >> 128) - u256{size_t_max} - size_t_max);
+    CHECK(mul_wide(static_uint<128, limb>{size_t_max},
+                   static_uint<128, limb>{size_t_max}) == square);
+    CHECK(fma(u256{size_t_max}, u256{size_t_max}, u256{1}) ==
+          square + 1);
+
+    using u72 = static_uint<72, limb>;
+    constexpr auto u72_max = std::numeric_limits<u72>::max();
+    CHECK((u72_max >> 64) == 0xff);
+    CHECK((u72_max + 1) == 0);
+    CHECK((u72_max * u72_max) == 1);
+}
+
+TEST_CASE("packed storage") {
+    using u96 = static_uint<96>;
+    using u160 = static_uint<160>;
+    constexpr auto u96_max = std::numeric_limits<u96>::max();
+    constexpr auto size_t_max =
+        std::numeric_limits<std::size_t>::max();
+
+    static_assert(sizeof(packed_static_uint<96>) == 12);
+    static_assert(sizeof(packed_static_uint<160>) == 20);
+    static_assert(alignof(packed_static_uint<96>) == 1);
+    static_assert(sizeof(packed_static_uint<72, std::uint32_t>) == 9);
+
+    SUBCASE("round trip") {
+        constexpr auto value = u96_max - u96{size_t_max} * 3;
+        constexpr auto packed = packed_static_uint<96>{value};
+        static_assert(packed.load() == value);
+        CHECK(u96{packed} == value);
+
+        auto const big = std::numeric_limits<u160>::max() >> 1;
+        CHECK(packed_static_uint<160>{big}.load() == big);
+    }
+    SUBCASE("little-endian bytes") {
+        auto const packed = packed_static_uint<96>{u96{0x0102}};
+        auto const* bytes =
+            reinterpret_cast<unsigned char const*>(&packed);
+        CHECK(bytes[0] == 0x02);
+        CHECK(bytes[1] == 0x01);
+        CHECK(bytes[11] == 0);
+    }
+    SUBCASE("bulk") {
+        std::array<u96, 4> values{u96{1}, u96{size_t_max}, u96_max,
+                                  u96_max >> 3};
+        std::array<packed_static_uint<96>, 4> packed{};
+        std::array<u96, 4> unpacked{};
+        CHECK(pack(values.begin(), values.end(), packed.begin()) ==
+              packed.end());
+        CHECK(unpack(packed.begin(), packed.end(),
+                     unpacked.begin()) == unpacked.end());
+        CHECK(values == unpacked);
+    }
+}
+
+#if defined(__SIZEOF_INT128__)
+TEST_CASE("native-width fast paths") {
+    __extension__ using native128 = unsigned __int128;
+    using u128 = static_uint<128>;
+    using u64 = static_uint<64, std::uint32_t>;
+
+    constexpr auto two_64 = u128{1ull << 32} * u128{1ull << 32};
+    auto const to_u128 = [&](native128 value) {
+        auto const hi = static_cast<std::uint64_t>(value >> 64);
+        auto const lo = static_cast<std::uint64_t>(value);
+        return u128{hi} * two_64 + u128{lo};
+    };
+    auto const equal = [&](u128 const& value, native128 expected) {
+        return (value >> 64) == static_cast<std::uint64_t>(
+                                    expected >> 64) &&
+               (value & u128{~0ull}) ==
+                   static_cast<std::uint64_t>(expected);
+    };
+
+    native128 const values[] = {
+        0, 1, ~native128{0}, native128{~0ull},
+        native128{~0ull} << 64, native128{0x0123456789abcdefull}
+                                    << 37 | 0xfedcba9876543210ull};
+    for (auto const a : values) {
+        for (auto const b : values) {
+            CHECK(equal(to_u128(a) + to_u128(b), a + b));
+            CHECK(equal(to_u128(a) - to_u128(b), a - b));
+            CHECK(equal(to_u128(a) * to_u128(b), a * b));
+            CHECK((to_u128(a) < to_u128(b)) == (a < b));
+            CHECK(compare(u64{static_cast<std::uint64_t>(a)},
+                          u64{static_cast<std::uint64_t>(b)}) ==
+                  (static_cast<std::uint64_t>(a) >
+                   static_cast<std::uint64_t>(b)) -
+                      (static_cast<std::uint64_t>(a) <
+                       static_cast<std::uint64_t>(b)));
+        }
+        for (unsigned int shift : {0u, 1u, 63u, 64u, 100u, 127u}) {
+            CHECK(equal(to_u128(a) >> shift, a >> shift));
+        }
+        CHECK((to_u128(a) >> 128) == 0);
+    }
+
+    static_assert((two_64 - 1) * (two_64 - 1) ==
+                  u128{1} - two_64 - two_64);
+    static_assert((u64{~0ull} >> 32) == 0xffffffffu);
+}
+#endif
+
+TEST_CASE("division, shifts and bitwise operations") {
+    using u256 = static_uint<256>;
+    constexpr auto u256_max = std::numeric_limits<u256>::max();
+    constexpr auto size_t_max =
+        std::numeric_limits<std::size_t>::max();
+
+    SUBCASE("division") {
+        constexpr auto a = u256{size_t_max} << 130 | 12345;
+        constexpr auto b = u256{size_t_max - 6} << 60 | 7;
+        constexpr auto result = divmod(a, b);
+        static_assert(result.quotient * b + result.remainder == a);
+        static_assert(result.remainder < b);
+        static_assert(a / b == result.quotient);
+        static_assert(a % b == result.remainder);
+
+        CHECK(u256_max / u256_max == 1);
+        CHECK(u256_max % u256_max == 0);
+        CHECK(u256{5} / u256_max == 0);
+        CHECK(u256{5} % u256_max == 5);
+        CHECK((u256_max / 3) * 3 == u256_max);
+        CHECK(u256_max % 10 == 5);
+        CHECK((u256{1} << 200) / (u256{1} << 100) == u256{1} << 100);
+
+        // 2^128 / (2^64 + 1) == 2^64 - 1, remainder 1
+        auto const two_128 = u256{1} << 128;
+        CHECK(two_128 / (u256{1} << 64 | 1) == size_t_max);
+        CHECK(two_128 % (u256{1} << 64 | 1) == 1);
+    }
+    SUBCASE("shifts") {
+        CHECK((u256{1} << 255) == (u256_max >> 255 << 255));
+        CHECK((u256{1} << 256) == 0);
+        CHECK((u256_max << 64 >> 64) == (u256_max >> 64));
+        CHECK((u256{size_t_max} << 100 >> 100) == size_t_max);
+        CHECK((static_uint<72>{0xff} << 68) ==
+              static_uint<72>{0xf} << 68);
+    }
+    SUBCASE("bitwise") {
+        CHECK((u256{0b1100} | 0b1010) == 0b1110);
+        CHECK((u256{0b1100} ^ 0b1010) == 0b0110);
+        CHECK(~u256_max == 0);
+        CHECK(~std::numeric_limits<static_uint<72>>::max() == 0);
+        CHECK((u256_max ^ u256_max) == 0);
+    }
+    SUBCASE("bit counting") {
+        CHECK(countl_zero(u256{}) == 256);
+        CHECK(bit_width(u256{}) == 0);
+        CHECK(countl_zero(u256_max) == 0);
+        CHECK(bit_width(u256{1} << 130) == 131);
+        CHECK(countl_zero(static_uint<72>{1}) == 71);
+    }
+}
+
+TEST_CASE("signed integers") {
+    using i256 = static_int<256>;
+    using u256 = static_uint<256>;
+    constexpr auto i256_max = std::numeric_limits<i256>::max();
+    constexpr auto i256_min = std::numeric_limits<i256>::min();
+
+    static_assert(sizeof(i256) == sizeof(u256));
+    static_assert(i256{-1}.to_unsigned() ==
+                  std::numeric_limits<u256>::max());
+    static_assert(i256{u256{5}} == 5);
+    static_assert(i256_min < i256{-1} && i256{-1} < 0 &&
+                  i256_max > 0);
+
+    SUBCASE("comparisons") {
+        CHECK(i256{-2} < i256{-1});
+        CHECK(i256{-1} < i256{1});
+        CHECK(i256{3} > i256{-3});
+        CHECK(i256_min < i256_max);
+        CHECK(i256_max + 1 == i256_min);
+    }
+    SUBCASE("arithmetic") {
+        CHECK(i256{-3} + 5 == 2);
+        CHECK(i256{3} - 5 == -2);
+        CHECK(i256{-3} * -5 == 15);
+        CHECK(i256{-3} * 5 == -15);
+        CHECK(-i256{7} == -7);
+        CHECK(-i256_min == i256_min);
+    }
+    SUBCASE("division") {
+        CHECK(i256{7} / -2 == -3);
+        CHECK(i256{7} % -2 == 1);
+        CHECK(i256{-7} / 2 == -3);
+        CHECK(i256{-7} % 2 == -1);
+        CHECK(i256{-7} / -2 == 3);
+        CHECK(i256{-7} % -2 == -1);
+        CHECK(i256_min / -1 == i256_min);
+    }
+    SUBCASE("shifts") {
+        CHECK((i256{-8} >> 1) == -4);
+        CHECK((i256{-7} >> 1) == -4);
+        CHECK((i256{-1} >> 300) == -1);
+        CHECK((i256{7} >> 1) == 3);
+        CHECK((i256_min >> 255) == -1);
+        CHECK((i256{-1} << 255) == i256_min);
+    }
+    SUBCASE("sizes that aren't a multiple of the limb size") {
+        using i72 = static_int<72>;
+        CHECK(i72{-1}.to_unsigned() ==
+              std::numeric_limits<static_uint<72>>::max());
+        CHECK(i72{-5} < i72{3});
+        CHECK((i72{-5} >> 2) == -2);
+        CHECK(i72{-100} / 7 == -14);
+        CHECK(std::numeric_limits<i72>::min() - 1 ==
+              std::numeric_limits<i72>::max());
+    }
+}
+
+TEST_CASE("fixed-point") {
+    using f64_64 = fixed<64, 64>;
+    using u128 = static_uint<128>;
+    constexpr auto size_t_max =
+        std::numeric_limits<std::size_t>::max();
+    constexpr auto one_and_half = f64_64::from_raw(u128{3} << 63);
+
+    static_assert(sizeof(f64_64) == sizeof(u128));
+    static_assert(one_and_half * one_and_half ==
+                  f64_64::from_raw(u128{9} << 62));
+    static_assert(f64_64{3} / f64_64{2} == one_and_half);
+    static_assert((f64_64{7} * one_and_half).integral_part() == 10);
+    static_assert((f64_64{7} * one_and_half).fractional_part() ==
+                  u128{1} << 63);
+
+    SUBCASE("division rounding") {
+        CHECK((f64_64{1} / f64_64{3}).to_raw() == size_t_max / 3);
+        CHECK((f64_64{2} / f64_64{3}).to_raw() ==
+              size_t_max / 3 * 2);
+        using nearest = fixed<64, 64, round_to_nearest>;
+        CHECK((nearest{1} / nearest{3}).to_raw() == size_t_max / 3);
+        CHECK((nearest{2} / nearest{3}).to_raw() ==
+              size_t_max / 3 * 2 + 1);
+    }
+    SUBCASE("multiplication rounding") {
+        // multiplying by a quarter gives 0.5, 1.5, 2.5 and 0.75 steps
+        auto const raw_products = {std::size_t{2}, std::size_t{6},
+                                   std::size_t{10}, std::size_t{3}};
+        auto const expected_zero = {0, 1, 2, 0};
+        auto const expected_nearest = {1, 2, 3, 1};
+        auto const expected_even = {0, 2, 2, 1};
+        using f8_4 = fixed<8, 4>;
+        using f8_4_nearest = fixed<8, 4, round_to_nearest>;
+        using f8_4_even = fixed<8, 4, round_to_nearest_even>;
+        auto zero = expected_zero.begin();
+        auto nearest = expected_nearest.begin();
+        auto even = expected_even.begin();
+        for (auto const raw : raw_products) {
+            auto const step = static_uint<12>{raw};
+            auto const quarter = static_uint<12>{4};
+            CHECK((f8_4::from_raw(step) * f8_4::from_raw(quarter))
+                      .to_raw() == *zero++);
+            CHECK((f8_4_nearest::from_raw(step) *
+                   f8_4_nearest::from_raw(quarter))
+                      .to_raw() == *nearest++);
+            CHECK((f8_4_even::from_raw(step) *
+                   f8_4_even::from_raw(quarter))
+                      .to_raw() == *even++);
+        }
+    }
+    SUBCASE("wrap around") {
+        using f8_4 = fixed<8, 4>;
+        CHECK(f8_4{255} + f8_4{1} == f8_4{0});
+        CHECK((f8_4{16} * f8_4{16}) == f8_4{0});
+    }
+}
+
+struct p25519 {
+    static constexpr auto value = (static_uint<256>{1} << 255) - 19;
+};
+struct secp256k1_p {
+    static constexpr auto value =
+        static_uint<256>{0} - (static_uint<256>{1} << 32) - 977;
+};
+struct secp256k1_n {
+    static constexpr auto value =
+        (static_uint<256>{0xfffffffffffffffe} << 128 |
+         static_uint<256>{0xbaaedce6af48a03b} << 64 |
+         0xbfd25e8cd0364141) +
+        (static_uint<256>{0xffffffffffffffff} << 192);
+};
+// 2^256 - 2^224 + 2^192 + 2^96 - 1, a Solinas prime
+struct p256 {
+    static constexpr auto value =
+        (static_uint<256>{0xffffffff00000001} << 192) +
+        (static_uint<256>{1} << 96) - 1u;
+};
+// 2^384 - 2^128 - 2^96 + 2^32 - 1, with c wider than a limb
+struct p384 {
+    static constexpr auto value = static_uint<384>{0} -
+                                  (static_uint<384>{1} << 128) -
+                                  (static_uint<384>{1} << 96) +
+                                  (static_uint<384>{1} << 32) - 1u;
+};
+struct even_modulus {
+    static constexpr auto value = static_uint<256>{1000000} << 180;
+};
+
+TEST_CASE("modular arithmetic") {
+    using u256 = static_uint<256>;
+    using u512 = static_uint<512>;
+    constexpr auto p = p25519::value;
+    constexpr auto size_t_max =
+        std::numeric_limits<std::size_t>::max();
+
+    // the value that goes through the reduction, and the one computed
+    // with a full division
+    auto const check_mul = [](auto const& a, auto const& b,
+                              u256 const& m) {
+        auto const product = mul_wide(a.value(), b.value());
+        auto const expected = truncate<256>(product % u512{m});
+        return (a * b).value() == expected;
+    };
+
+    SUBCASE("montgomery") {
+        using engine =
+            detail::reduction_for<256, std::uint64_t, secp256k1_n>;
+        static_assert(std::is_same_v<
+                      engine, detail::montgomery_reduction<
+                                  256, std::uint64_t, secp256k1_n>>);
+        using fe = mod_uint<256, secp256k1_n>;
+        constexpr auto n = secp256k1_n::value;
+        constexpr auto a = fe{n - 1};
+        static_assert((a * a).value() == 1);
+
+        auto const b = fe{u256{size_t_max} << 190 | 12345};
+        CHECK(check_mul(b, b, n));
+        CHECK(check_mul(b, a, n));
+        CHECK(b * b.inv() == fe{1});
+        CHECK(b.pow(n - 1) == fe{1});
+        static_assert(!detail::is_solinas_form(n));
+    }
+    SUBCASE("solinas") {
+        static_assert(!detail::is_special_form(p256::value));
+        static_assert(detail::is_solinas_form(p256::value));
+        static_assert(std::is_same_v<
+                      detail::reduction_for<256, std::uint64_t, p256>,
+                      detail::solinas_reduction<256, std::uint64_t,
+                                                p256>>);
+        using fe = mod_uint<256, p256>;
+        constexpr auto m = p256::value;
+        constexpr auto a = fe{m - 1};
+        static_assert((a * a).value() == 1);
+
+        auto const b = fe{u256{size_t_max} << 190 | 12345};
+        CHECK(check_mul(b, b, m));
+        CHECK(check_mul(b, a, m));
+        CHECK(check_mul(a, fe{m - 2}, m));
+        CHECK(b * b.inv() == fe{1});
+        CHECK(b.pow(m - 1) == fe{1});
+        CHECK(fe{3}.pow(5).value() == 243);
+    }
+    SUBCASE("special form") {
+        using engine =
+            detail::reduction_for<256, std::uint64_t, secp256k1_p>;
+        static_assert(std::is_same_v<
+                      engine, detail::special_form_reduction<
+                                  256, std::uint64_t, secp256k1_p>>);
+        using k1 = mod_uint<256, secp256k1_p>;
+        constexpr auto k1_p = secp256k1_p::value;
+        auto const c = k1{u256{size_t_max} << 190 | 12345};
+        CHECK(check_mul(c, c, k1_p));
+        CHECK(check_mul(c, k1{k1_p - 1}, k1_p));
+        CHECK(c * c.inv() == k1{1});
+
+        using fe = mod_uint<256, p25519>;
+        constexpr auto a = fe{p - 1};
+        static_assert((a * a).value() == 1);
+        static_assert((a + fe{2}).value() == 1);
+        static_assert((fe{1} - fe{2}).value() == p - 1);
+
+        auto const b = fe{u256{size_t_max} << 190 | 12345};
+        CHECK(fe{p} == fe{0});
+        CHECK(fe{p + 3}.value() == 3);
+        CHECK(check_mul(b, b, p));
+        CHECK(check_mul(b, a, p));
+        CHECK(b * b.inv() == fe{1});
+        CHECK(b.pow(p - 1) == fe{1});
+        CHECK(fe{3}.pow(5).value() == 243);
+        CHECK(b - b == fe{});
+        CHECK(-b + b == fe{});
+
+        static_assert(std::is_same_v<
+                      detail::reduction_for<384, std::uint64_t, p384>,
+                      detail::special_form_reduction<
+                          384, std::uint64_t, p384>>);
+        using p384_fe = mod_uint<384, p384>;
+        using u384 = static_uint<384>;
+        constexpr auto p384_m = p384::value;
+        static_assert((p384_fe{p384_m - 1} * p384_fe{p384_m - 1})
+                          .value() == 1);
+        auto const d = p384_fe{u384{size_t_max} << 320 | 12345};
+        auto const e = p384_fe{p384_m - 2};
+        CHECK((d * e).value() ==
+              truncate<384>(mul_wide(d.value(), e.value()) %
+                            static_uint<768>{p384_m}));
+        CHECK(d * d.inv() == p384_fe{1});
+    }
+    SUBCASE("barrett") {
+        using fe = mod_uint<256, even_modulus>;
+        constexpr auto m = even_modulus::value;
+        static_assert((fe{m - 1} * fe{m - 1}).value() == 1);
+
+        auto const b = fe{u256{size_t_max} << 150 | 12345};
+        CHECK(fe{m + 3}.value() == 3);
+        CHECK(check_mul(b, b, m));
+        CHECK(check_mul(b, fe{m - 1}, m));
+        CHECK(fe{3}.pow(5).value() == 243);
+        CHECK((b + fe{m - 1}).value() == b.value() - 1);
+    }
+}
+
+using moduli =
+    doctest::Types<p25519, p256, secp256k1_n, even_modulus>;
+
+TEST_CASE_TEMPLATE("lazy modular accumulation", modulus, moduli) {
+    using fe = mod_uint<256, modulus>;
+    using u256 = static_uint<256>;
+    constexpr auto size_t_max =
+        std::numeric_limits<std::size_t>::max();
+
+    auto accumulator = mod_accumulator<256, modulus>{};
+    auto expected = fe{};
+    auto a = fe{u256{size_t_max} << 190 | 12345};
+    auto b = fe{modulus::value - 1};
+    for (int i = 0; i < 300; ++i) {
+        accumulator.add_product(a, b);
+        expected += a * b;
+        a *= a + fe{1};
+        b += a;
+    }
+    CHECK(accumulator.value() == expected);
+
+    accumulator.add(fe{42});
+    CHECK(accumulator.value() == expected + fe{42});
+
+    accumulator.reset();
+    CHECK(accumulator.value() == fe{});
+
+    // default construction starts from zero too
+    mod_accumulator<256, modulus> fresh;
+    fresh.add_product(a, b);
+    CHECK(fresh.value() == a * b);
+    constexpr auto from_default = [] {
+        mod_accumulator<256, modulus> sum;
+        sum.add(fe{5});
+        return sum.value();
+    }();
+    static_assert(from_default == fe{5});
+}
+
+TEST_CASE("exact sums and dot products") {
+    using u128 = static_uint<128>;
+    constexpr auto u128_max = std::numeric_limits<u128>::max();
+
+    std::array<u128, 1000> values{};
+    std::fill(values.begin(), values.end(), u128_max);
+
+    auto const sum = exact_sum<1000>(values.data(), values.size());
+    static_assert(std::is_same_v<decltype(sum),
+                                 static_uint<138> const>);
+    CHECK(sum == static_uint<138>{u128_max} * 1000u);
+    CHECK(exact_sum<1000>(values.data(), 0) == 0);
+
+    auto const dot =
+        exact_dot<1000>(values.data(), values.data(), values.size());
+    static_assert(std::is_same_v<decltype(dot),
+                                 static_uint<266> const>);
+    CHECK(dot == static_uint<266>{mul_wide(u128_max, u128_max)} *
+                     1000u);
+
+    // no extra limb needed
+    static constexpr std::array<static_uint<72>, 3> small{
+        static_uint<72>{1}, static_uint<72>{2}, static_uint<72>{3}};
+    static_assert(exact_sum<3>(small.data(), 3) == 6);
+}
+
+TEST_CASE("narrowing conversions") {
+    using u256 = static_uint<256>;
+    using u100 = static_uint<100>;
+    constexpr auto u256_max = std::numeric_limits<u256>::max();
+    constexpr auto u100_max = std::numeric_limits<u100>::max();
+
+    auto const x = u256_max / 3u;
+    CHECK(truncate<100>(x) == (x & u256{u100_max}));
+    CHECK(truncate<256>(x) == x);
+    CHECK(truncate<7>(x) == 0x55);
+
+    CHECK(checked_narrow<100>(u256{u100_max}) == u100_max);
+    CHECK(!checked_narrow<100>(u256{u100_max} + 1u));
+    CHECK(!checked_narrow<100>(u256{1} << 255));
+    CHECK(checked_narrow<64>(u256{12345}) == 12345);
+    CHECK(!checked_narrow<63>(u256{1} << 63));
+
+    CHECK(static_cast<std::uint64_t>(x) == 0x5555555555555555);
+    CHECK(static_cast<std::uint64_t>(u256{42}) == 42);
+    CHECK(static_cast<std::uint64_t>(
+              static_uint<256, std::uint32_t>{~0ull} << 4) ==
+          0xfffffffffffffff0);
+    CHECK(static_cast<std::uint64_t>(static_uint<40>{~0ull}) ==
+          0xffffffffff);
+    static_assert(static_cast<std::uint64_t>(u256{7}) == 7);
+#ifdef __SIZEOF_INT128__
+    auto const wide = x.to_u128();
+    CHECK(static_cast<std::uint64_t>(wide) == 0x5555555555555555);
+    CHECK(static_cast<std::uint64_t>(wide >> 64) ==
+          0x5555555555555555);
+    CHECK((u256{42}.to_u128() == 42));
+    CHECK((static_uint<8>{255}.to_u128() == 255));
+#endif
+}
+
+TEST_CASE("construction from limbs and 128-bit integers") {
+    using u256 = static_uint<256>;
+    using u100 = static_uint<100>;
+
+    auto const from_array =
+        u256{std::array<std::uint64_t, 2>{0x1234, 0x5678}};
+    CHECK(from_array == (u256{0x5678} << 64) + 0x1234u);
+    CHECK(u100{std::array<std::uint64_t, 2>{1, ~0ull}} ==
+          (u100{0xfffffffff} << 64) + 1u);
+    static_assert(u256{std::array<std::uint64_t, 4>{1, 2, 3, 4}} ==
+                  (u256{4} << 192) + (u256{3} << 128) +
+                      (u256{2} << 64) + 1u);
+
+    std::uint64_t const limbs[] = {5, 6, 7};
+    CHECK(u256::from_limbs(limbs, 2) == (u256{6} << 64) + 5u);
+    CHECK(u256::from_limbs(limbs, 0) == 0);
+    CHECK(static_uint<64>::from_limbs(limbs, 3) == 5);
+    CHECK(u100::from_limbs(limbs, 3) == (u100{6} << 64) + 5u);
+
+#ifdef __SIZEOF_INT128__
+    __extension__ using u128_t = unsigned __int128;
+    constexpr auto big = (u128_t{0xabcdef} << 64) | 0x123456789u;
+    CHECK(u256{big} == (u256{0xabcdef} << 64) + 0x123456789u);
+    CHECK(static_uint<72>{big} == (static_uint<72>{0xef} << 64) +
+                                      0x123456789u);
+    CHECK(static_uint<256, std::uint32_t>{big} ==
+          (static_uint<256, std::uint32_t>{0xabcdef} << 64) +
+              0x123456789u);
+    CHECK((static_cast<u128_t>(u256{big}) == big));
+    CHECK((static_cast<u128_t>(u256{big} << 100) == big << 100));
+    u256 const sum = u256{1} + big;
+    CHECK(sum == u256{big} + 1u);
+    static_assert(u256{u128_t{1} << 127} == u256{1} << 127);
+#endif
+}
+
+TEST_CASE("floating-point conversions") {
+    using u256 = static_uint<256>;
+    constexpr auto u256_max = std::numeric_limits<u256>::max();
+
+    CHECK(to_double(u256{}) == 0.0);
+    CHECK(to_double(u256{12345}) == 12345.0);
+    CHECK(to_double(u256{1} << 200) == std::ldexp(1.0, 200));
+    CHECK(to_double(u256_max) == std::ldexp(1.0, 256));
+    static_assert(to_double(u256{3} << 100) == 0x3p100);
+
+    // 2^60 + 2^7 is halfway between two doubles, and ties to even;
+    // anything past it rounds up
+    auto const halfway = (u256{1} << 60) + (u256{1} << 7);
+    CHECK(to_double(halfway) == std::ldexp(1.0, 60));
+    CHECK(to_double(halfway + 1u) == std::ldexp(1.0, 60) + 256.0);
+    CHECK(to_double(halfway + (u256{1} << 8)) ==
+          std::ldexp(1.0, 60) + 512.0);
+    auto const far_halfway = (u256{1} << 250) + (u256{1} << 197);
+    CHECK(to_double(far_halfway) == std::ldexp(1.0, 250));
+    CHECK(to_double(far_halfway + 1u) ==
+          std::ldexp(1.0, 250) + std::ldexp(1.0, 198));
+    CHECK(to_double(std::numeric_limits<static_uint<1100>>::max()) ==
+          std::numeric_limits<double>::infinity());
+    CHECK(to_long_double(u256{1} << 70) == std::ldexp(1.0L, 70));
+    CHECK(to_long_double((u256{1} << 63) + 1u) ==
+          std::ldexp(1.0L, 63) + 1);
+
+    CHECK(from_double<256>(12345.75) == 12345);
+    CHECK(from_double<256>(std::ldexp(1.0, 200)) == u256{1} << 200);
+    CHECK(from_double<256>(std::ldexp(5.0, 251)) == u256{5} << 251);
+    CHECK(from_double<256>(std::ldexp(3.0, 100)) == u256{3} << 100);
+    CHECK(from_double<256, std::uint32_t>(std::ldexp(3.0, 100)) ==
+          static_uint<256, std::uint32_t>{3} << 100);
+    CHECK(from_double<256>(0.5) == 0);
+    CHECK(from_double<256>(-2.0) == 0);
+    using double_limits = std::numeric_limits<double>;
+    CHECK(from_double<256>(double_limits::quiet_NaN()) == 0);
+    CHECK(from_double<256>(double_limits::infinity()) == 0);
+    CHECK(from_long_double<256>(std::ldexp(1.0L, 63) + 1) ==
+          (u256{1} << 63) + 1u);
+    auto const value = u256{0x1fffffffffffff} << 150;
+    CHECK(from_double<256>(to_double(value)) == value);
+}
+
+TEST_CASE("literals") {
+    using namespace static_uint_literals;
+    using u128 = static_uint<128>;
+    using u256 = static_uint<256>;
+    using u512 = static_uint<512>;
+
+    static_assert(0_u128 == u128{});
+    static_assert(1234567890123456789_u128 == 1234567890123456789);
+    static_assert(0x1234_u256 == 0x1234);
+    static_assert(0b1011_u256 == 11);
+    static_assert(0777_u256 == 511);
+    static_assert(0XaBc_u256 == 0xabc);
+    static_assert(1'000'000_u512 == 1000000);
+    static_assert(0x1'0000'0000'0000'0000'0000'0000'0000'0000_u256 ==
+                  u256{1} << 128);
+    static_assert(0xffffffff'ffffffff'ffffffff'ffffffff_u128 ==
+                  std::numeric_limits<u128>::max());
+    static_assert(
+        340282366920938463463374607431768211455_u128 ==
+        std::numeric_limits<u128>::max());
+    constexpr auto big =
+        0x1'0000'0000'0000'0000'0000'0000'0000'0000'0000'0000_u512;
+    static_assert(big == u512{1} << 160);
+    static_assert(0xfffffffe'ffffffff'ffffffff'0000000f_u256 ==
+                  (u256{0xfffffffeffffffff} << 64) +
+                      0xffffffff0000000fu);
+
+    CHECK(1000000000000000000000000000000_u128 / 1000000000000000u ==
+          1000000000000000);
+}
+
+TEST_CASE("powers and logarithms") {
+    using u256 = static_uint<256>;
+    constexpr auto u256_max = std::numeric_limits<u256>::max();
+
+    auto const [power, overflow] = ipow(u256{3}, 161);
+    CHECK(!overflow);
+    CHECK(power / u256{3} == ipow(u256{3}, 160).power);
+    CHECK(ipow(u256{3}, 0).power == 1);
+    CHECK(ipow(u256{0}, 0).power == 1);
+    CHECK(ipow(u256{0}, 5).power == 0);
+    CHECK(ipow(u256{2}, 255).power == u256{1} << 255);
+    CHECK(!ipow(u256{2}, 255).overflow);
+    CHECK(ipow(u256{2}, 256).overflow);
+    CHECK(ipow(u256{2}, 256).power == 0);
+    CHECK(ipow(u256{3}, 162).overflow);
+    CHECK(!ipow(u256_max, 1).overflow);
+    CHECK(ipow(u256_max, 2).overflow);
+    static_assert(ipow(static_uint<64>{10}, 19).power ==
+                  10000000000000000000u);
+
+    CHECK(log2_floor(u256{1}) == 0);
+    CHECK(log2_floor(u256{1} << 200) == 200);
+    CHECK(log2_floor(u256_max) == 255);
+
+    auto ten = u256{1};
+    for (unsigned int i = 0; i < 78; ++i) {
+        CHECK(log10_floor(ten) == i);
+        if (i != 0) {
+            CHECK(log10_floor(ten - 1u) == i - 1);
+        }
+        CHECK(num_digits(ten) == i + 1);
+        ten *= 10u;
+    }
+    CHECK(log10_floor(u256_max) == 77);
+    CHECK(num_digits(u256{}) == 1);
+    CHECK(num_digits(static_uint<7>{127}) == 3);
+    CHECK(num_digits(static_uint<256, std::uint32_t>{1000000}) == 7);
+    static_assert(num_digits(u256{99999}) == 5);
+
+    // past the sizes that keep a table of powers of ten
+    using u8192 = static_uint<8192>;
+    auto const big_ten = ipow(u8192{10}, 2466).power;
+    CHECK(log10_floor(big_ten) == 2466);
+    CHECK(log10_floor(big_ten - 1u) == 2465);
+    CHECK(num_digits(u8192{1} << 8191) == 2466);
+    CHECK(num_digits(std::numeric_limits<u8192>::max()) == 2467);
+    CHECK(num_digits(u8192{}) == 1);
+    CHECK(num_digits(u8192{1000}) == 4);
+    static_assert(num_digits(u8192{99999}) == 5);
+}
+
+TEST_CASE("decimal output") {
+    using namespace static_uint_literals;
+    using u256 = static_uint<256>;
+
+    auto const to_string = [](auto const& value) {
+        char buffer[100];
+        auto const result =
+            to_chars(buffer, buffer + sizeof(buffer), value);
+        REQUIRE(result.ec == std::errc{});
+        return std::string(buffer, result.ptr);
+    };
+    CHECK(to_string(u256{}) == "0");
+    CHECK(to_string(u256{7}) == "7");
+    CHECK(to_string(u256{10000000000000000000u}) ==
+          "10000000000000000000");
+    CHECK(to_string(u256{9999999999999999999u}) ==
+          "9999999999999999999");
+    CHECK(to_string(std::numeric_limits<u256>::max()) ==
+          "11579208923731619542357098500868790785326998466564"
+          "0564039457584007913129639935");
+    CHECK(to_string(1'000000000'000000000'000000000_u256) ==
+          "1000000000000000000000000000");
+    CHECK(to_string(static_uint<256, std::uint32_t>{1} << 200) ==
+          "16069380442589902755419620923411626025222029937827"
+          "92835301376");
+    CHECK(to_string(static_uint<5>{31}) == "31");
+
+    char small[4];
+    auto const result = to_chars(small, small + 4, u256{12345});
+    CHECK(result.ec == std::errc::value_too_large);
+    CHECK(result.ptr == small + 4);
+    CHECK(to_chars(small, small + 4, u256{1234}).ptr == small + 4);
+
+    using u8192 = static_uint<8192>;
+    auto stream = std::ostringstream{};
+    stream << std::numeric_limits<u8192>::max();
+    auto const digits = stream.str();
+    CHECK(digits.size() == 2467);
+    CHECK(digits.substr(0, 20) == "10907481356194159294");
+    CHECK(digits.substr(2447) == "86505665475715792895");
+    stream.str("");
+    stream << ipow(u8192{10}, 2466).power;
+    CHECK(stream.str() == "1" + std::string(2466, '0'));
+    stream.str("");
+    stream << u8192{};
+    CHECK(stream.str() == "0");
+}
+
+TEST_CASE("half views and join") {
+    using u256 = static_uint<256>;
+    using u512 = static_uint<512>;
+    constexpr auto u256_max = std::numeric_limits<u256>::max();
+
+    auto const hi = u256_max / 3u;
+    auto const lo = u256_max / 5u;
+    auto x = join(hi, lo);
+    CHECK(x == (u512{hi} << 256) + u512{lo});
+    CHECK(x.hi().load() == hi);
+    CHECK(x.lo().load() == lo);
+    auto const& cx = x;
+    CHECK(cx.hi().load() == x >> 256);
+    CHECK(cx.lo().load() == (x & u512{u256_max}));
+    CHECK(join(cx.hi().load(), cx.lo().load()) == x);
+
+    // writes through a view land in the whole value
+    x.lo().store(u256{7});
+    CHECK(x == (u512{hi} << 256) + 7u);
+    auto const half = u256{1} << 255;
+    auto const view = x.hi();
+    detail::add_limbs(view.limbs(), view.limb_count,
+                      detail::limb_access::get(half).data(), 4);
+    CHECK(x.hi().load() == hi + half);
+    CHECK(x.lo().load() == 7);
+
+    static_assert(join(u256{1}, u256{2}).hi().load() == 1);
+    static_assert(join(static_uint<64, std::uint32_t>{3},
+                       static_uint<64, std::uint32_t>{4})
+                      .lo()
+                      .load() == 4);
+}
+
+TEST_CASE("destination-passing operations") {
+    using u256 = static_uint<256>;
+    using u200 = static_uint<200>;
+    constexpr auto u256_max = std::numeric_limits<u256>::max();
+    auto const a = u256_max / 7u;
+    auto const b = u256_max / 13u + 5u;
+
+    auto dst = u256{};
+    add_into(dst, a, b);
+    CHECK(dst == a + b);
+    sub_into(dst, b, a);
+    CHECK(dst == b - a);
+    mul_into(dst, a, b);
+    CHECK(dst == a * b);
+    and_into(dst, a, b);
+    CHECK(dst == (a & b));
+    shr_into(dst, a, 131);
+    CHECK(dst == a / (u256{1} << 131));
+    shr_into(dst, a, 256);
+    CHECK(dst == 0);
+
+    // the destination may be either operand
+    auto x = a;
+    add_into(x, x, b);
+    CHECK(x == a + b);
+    x = a;
+    sub_into(x, b, x);
+    CHECK(x == b - a);
+    x = a;
+    mul_into(x, x, x);
+    CHECK(x == a * a);
+    x = b;
+    mul_into(x, a, x);
+    CHECK(x == a * b);
+    x = a;
+    shr_into(x, x, 70);
+    CHECK(x == a / (u256{1} << 70));
+
+    // results are truncated to the size
+    constexpr auto u200_max = std::numeric_limits<u200>::max();
+    auto y = u200{};
+    add_into(y, u200_max, u200{2});
+    CHECK(y == 1);
+    sub_into(y, u200{}, u200{1});
+    CHECK(y == u200_max);
+    mul_into(y, u200_max, u200_max);
+    CHECK(y == 1);
+}
+
+TEST_CASE("bounded-length integers") {
+    using u1024 = static_uint<1024>;
+    using b1024 = bounded_uint<1024>;
+    constexpr auto u1024_max = std::numeric_limits<u1024>::max();
+
+    auto const small = b1024{12345};
+    CHECK(small.used_limbs() == 1);
+    CHECK(b1024{}.used_limbs() == 0);
+    CHECK(b1024{u1024_max}.used_limbs() == 16);
+
+    auto const a = u1024_max >> 700;
+    auto const b = (u1024{1} << 300) + 77u;
+    auto const x = b1024{a};
+    auto const y = b1024{b};
+    CHECK(x.used_limbs() == 6);
+    CHECK((x + y).to_static_uint() == a + b);
+    CHECK((x - y).to_static_uint() == a - b);
+    CHECK((x * y).to_static_uint() == a * b);
+    CHECK((x * y).used_limbs() == 10);
+    CHECK((x << 450).to_static_uint() == a << 450);
+    CHECK((x >> 200).to_static_uint() == a >> 200);
+    CHECK((x >> 384).used_limbs() == 0);
+    CHECK(x > y);
+    CHECK(y < x);
+    CHECK(x == b1024{a});
+    CHECK(x != y);
+
+    // wrapping around, and back down to fewer limbs
+    auto const wrapped = y - x;
+    CHECK(wrapped.to_static_uint() == b - a);
+    CHECK(wrapped.used_limbs() == 16);
+    CHECK((wrapped + x).used_limbs() == 5);
+    CHECK(b1024{u1024_max} + b1024{1} == 0);
+    auto const all_ones = b1024{u1024_max};
+    CHECK((all_ones * all_ones).to_static_uint() == 1);
+    CHECK(static_cast<u1024>(small << 1023) == u1024{1} << 1023);
+}
+
+TEST_CASE("carry-save accumulation") {
+    using u256 = static_uint<256>;
+    constexpr auto u256_max = std::numeric_limits<u256>::max();
+
+    auto accumulator = carry_save_uint<256>{};
+    auto expected = u256{};
+    auto value = u256_max >> 3;
+    for (int i = 0; i < 1000; ++i) {
+        accumulator += value;
+        expected += value;
+        value = value * 3u + 1u;
+    }
+    CHECK(accumulator.normalize() == expected);
+
+    auto other = carry_save_uint<256>{u256_max};
+    other += u256{2};
+    accumulator += other;
+    CHECK(accumulator.normalize() == expected + 1u);
+
+    using u72 = static_uint<72>;
+    auto small = carry_save_uint<72>{std::numeric_limits<u72>::max()};
+    small += u72{1};
+    small += u72{1};
+    CHECK(small.normalize() == 1);
+
+    // default construction starts from zero
+    carry_save_uint<256> fresh;
+    fresh += value;
+    CHECK(fresh.normalize() == value);
+    constexpr auto from_default = [] {
+        carry_save_uint<256> sum;
+        sum += u256{5};
+        sum += u256{7};
+        return sum.normalize();
+    }();
+    static_assert(from_default == 12);
+}
+
+TEST_CASE("expression templates") {
+    using static_uint_expr::eval;
+    using static_uint_expr::lazy;
+    using u2048 = static_uint<2048>;
+    constexpr auto u2048_max = std::numeric_limits<u2048>::max();
+    constexpr auto size_t_max =
+        std::numeric_limits<std::size_t>::max();
+
+    auto const a = u2048_max >> 7;
+    auto const b = u2048{size_t_max} << 1000;
+    auto const c = u2048_max / 3u;
+    auto const mask = u2048_max >> 1024;
+
+    u2048 const sum_and_mask = (lazy(a) + b + c) & (mask >> 3);
+    CHECK(sum_and_mask == ((a + b + c) & (mask >> 3)));
+
+    u2048 const shifted_sum = (lazy(a) + b - c) >> 100;
+    CHECK(shifted_sum == (a + b - c) >> 100);
+
+    CHECK(eval(~((lazy(a) ^ b) | c) << 65) == ~((a ^ b) | c) << 65);
+    CHECK(eval((lazy(a) << 3) + (lazy(b) >> 2) - ~lazy(c)) ==
+          (a << 3) + (b >> 2) - ~c);
+
+    using u72 = static_uint<72>;
+    constexpr auto u72_max = std::numeric_limits<u72>::max();
+    CHECK(eval(~lazy(u72{}) >> 8) == u72_max >> 8);
+    CHECK(eval((lazy(u72_max) + u72{1}) >> 1) == 0);
+}